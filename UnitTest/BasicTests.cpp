@@ -1,13 +1,59 @@
 #include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "../include/SIMDInstructionSet.h"
 
 #include "../include/Xoshiro256Plus.h"
+#include "../include/Xoshiro256PlusBank.h"
+#include "../include/Xoshiro256PlusEngine.h"
+#include "../include/Xoshiro256PlusParallelFill.h"
+#include "../include/Xoshiro256PlusPool.h"
+#include "../include/Xoshiro256PlusProducer.h"
+#include "../include/Xoshiro256PlusShared.h"
+#include "../include/Xoshiro256PlusUniformInt.h"
 #include "Xoshiro256PlusReference.h"
 
 typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE> Xoshiro256PlusSerial;
 typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2> Xoshiro256PlusAVX2;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE, 8> Xoshiro256PlusSerialEightLanes;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2, 8> Xoshiro256PlusAVX2EightLanes;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE, 16> Xoshiro256PlusSerialSixteenLanes;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2, 16> Xoshiro256PlusAVX2SixteenLanes;
+
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE, 4, SEFUtility::RNG::LaneInitialization::OnFirstUse>
+    Xoshiro256PlusSerialLazy;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2, 4, SEFUtility::RNG::LaneInitialization::OnFirstUse>
+    Xoshiro256PlusAVX2Lazy;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE, 8, SEFUtility::RNG::LaneInitialization::OnFirstUse>
+    Xoshiro256PlusSerialEightLanesLazy;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2, 8, SEFUtility::RNG::LaneInitialization::OnFirstUse>
+    Xoshiro256PlusAVX2EightLanesLazy;
+
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE, 4,
+                                        SEFUtility::RNG::LaneInitialization::OnConstruction,
+                                        SEFUtility::RNG::StateLayout::ScalarOnly>
+    Xoshiro256PlusScalarOnly;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2, 4,
+                                        SEFUtility::RNG::LaneInitialization::OnConstruction,
+                                        SEFUtility::RNG::StateLayout::Full>
+    Xoshiro256PlusAVX2Full;
+
+typedef SEFUtility::RNG::Xoshiro256PlusBank<SIMDInstructionSet::NONE> Xoshiro256PlusBankSerial;
+typedef SEFUtility::RNG::Xoshiro256PlusBank<SIMDInstructionSet::AVX2> Xoshiro256PlusBankAVX2;
+
+#ifdef __AVX512_AVAILABLE__
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX512> Xoshiro256PlusAVX512;
+typedef SEFUtility::RNG::Xoshiro256PlusBank<SIMDInstructionSet::AVX512> Xoshiro256PlusBankAVX512;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX512, 16> Xoshiro256PlusAVX512SixteenLanes;
+#endif
 
 constexpr size_t NUM_SAMPLES = 1000;
 constexpr uint64_t SEED = 1;
@@ -245,6 +291,31 @@ TEST_CASE("Reference, Serial and SIMD Implementations Match", "[basic]")
         }
     }
 
+    SECTION("Serial and AVX Copy With Jump Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx_rng(SEED);
+
+        Xoshiro256PlusSerial serial_short_copy(serial_rng, Xoshiro256PlusSerial::JumpOnCopy::Short);
+        Xoshiro256PlusAVX2 avx_short_copy(avx_rng, Xoshiro256PlusAVX2::JumpOnCopy::Short);
+        Xoshiro256PlusSerial serial_long_copy(serial_rng, Xoshiro256PlusSerial::JumpOnCopy::Long);
+        Xoshiro256PlusAVX2 avx_long_copy(avx_rng, Xoshiro256PlusAVX2::JumpOnCopy::Long);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto next_four_serial_short = serial_short_copy.next4();
+            auto next_four_avx_short = avx_short_copy.next4();
+            auto next_four_serial_long = serial_long_copy.next4();
+            auto next_four_avx_long = avx_long_copy.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(next_four_serial_short[j] == next_four_avx_short[j]);
+                REQUIRE(next_four_serial_long[j] == next_four_avx_long[j]);
+            }
+        }
+    }
+
     SECTION("Serial and AVX Double Bounding Match")
     {
         Xoshiro256PlusSerial serial_rng(SEED);
@@ -262,3 +333,3386 @@ TEST_CASE("Reference, Serial and SIMD Implementations Match", "[basic]")
         }
     }
 }
+
+TEST_CASE("Bulk Fills", "[basic]")
+{
+    constexpr size_t FILL_SIZE = 1003;
+
+    SECTION("Fill Matches next4")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx_rng(SEED);
+        Xoshiro256PlusSerial reference_rng(SEED);
+
+        alignas(32) uint64_t serial_buffer[FILL_SIZE + 1];
+        alignas(32) uint64_t avx_buffer[FILL_SIZE + 1];
+
+        //  Fill at an aligned and then a misaligned address, each with a partial tail
+
+        serial_rng.fill(serial_buffer, FILL_SIZE);
+        avx_rng.fill(avx_buffer, FILL_SIZE);
+
+        for (auto i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto next_four = reference_rng.next4();
+
+            for (auto j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_buffer[i + j] == next_four[j]);
+                REQUIRE(avx_buffer[i + j] == next_four[j]);
+            }
+        }
+
+        serial_rng.fill(serial_buffer + 1, FILL_SIZE);
+        avx_rng.fill(avx_buffer + 1, FILL_SIZE);
+
+        for (auto i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto next_four = reference_rng.next4();
+
+            for (auto j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_buffer[i + j + 1] == next_four[j]);
+                REQUIRE(avx_buffer[i + j + 1] == next_four[j]);
+            }
+        }
+    }
+
+    SECTION("Double Fill Matches dnext4")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx_rng(SEED);
+        Xoshiro256PlusSerial reference_rng(SEED);
+
+        alignas(32) double serial_buffer[FILL_SIZE + 1];
+        alignas(32) double avx_buffer[FILL_SIZE + 1];
+
+        serial_rng.fill(serial_buffer + 1, FILL_SIZE, -5, 10);
+        avx_rng.fill(avx_buffer + 1, FILL_SIZE, -5, 10);
+
+        for (auto i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto next_four = reference_rng.dnext4(-5, 10);
+
+            for (auto j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_buffer[i + j + 1] == next_four[j]);
+                REQUIRE(avx_buffer[i + j + 1] == next_four[j]);
+            }
+        }
+
+        serial_rng.fill(serial_buffer, FILL_SIZE);
+        avx_rng.fill(avx_buffer, FILL_SIZE);
+
+        for (auto i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto next_four = reference_rng.dnext4();
+
+            for (auto j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_buffer[i + j] == next_four[j]);
+                REQUIRE(avx_buffer[i + j] == next_four[j]);
+            }
+        }
+    }
+
+    SECTION("Byte Fill Matches next4")
+    {
+        constexpr size_t NUM_BYTES = (FILL_SIZE * 8) + 5;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx_rng(SEED);
+        Xoshiro256PlusSerial reference_rng(SEED);
+
+        alignas(32) uint8_t serial_buffer[NUM_BYTES + 3];
+        alignas(32) uint8_t avx_buffer[NUM_BYTES + 3];
+
+        serial_rng.fill_bytes(serial_buffer + 3, NUM_BYTES);
+        avx_rng.fill_bytes(avx_buffer + 3, NUM_BYTES);
+
+        for (auto i = 0; i < NUM_BYTES; i += 32)
+        {
+            alignas(32) uint64_t expected[4];
+
+            reference_rng.fill(expected, 4);
+
+            size_t num_bytes_to_compare = std::min<size_t>(NUM_BYTES - i, 32);
+
+            REQUIRE(memcmp(serial_buffer + 3 + i, expected, num_bytes_to_compare) == 0);
+            REQUIRE(memcmp(avx_buffer + 3 + i, expected, num_bytes_to_compare) == 0);
+        }
+
+        uint64_t next_reference = reference_rng.next4()[0];
+
+        REQUIRE(serial_rng.next4()[0] == next_reference);
+        REQUIRE(avx_rng.next4()[0] == next_reference);
+    }
+}
+
+TEST_CASE("Eight Lanes", "[basic]")
+{
+    SECTION("Streams Match - next8")
+    {
+        //  Each lane of the reference is a long jump beyond the previous lane
+
+        SEFUtility::RNG::SplitMix64 split_mix(SEED);
+
+        Xoshiro256PlusReference::s[0] = split_mix.next();
+        Xoshiro256PlusReference::s[1] = split_mix.next();
+        Xoshiro256PlusReference::s[2] = split_mix.next();
+        Xoshiro256PlusReference::s[3] = split_mix.next();
+
+        std::array<std::array<uint64_t, 4>, 8> reference_lanes;
+
+        for (auto& lane : reference_lanes)
+        {
+            Xoshiro256PlusReference::long_jump();
+
+            std::copy(Xoshiro256PlusReference::s, Xoshiro256PlusReference::s + 4, lane.begin());
+        }
+
+        Xoshiro256PlusSerialEightLanes serial_rng(SEED);
+        Xoshiro256PlusAVX2EightLanes avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto next_serial = serial_rng.next8();
+            auto next_avx2 = avx2_rng.next8();
+#ifdef __AVX512_AVAILABLE__
+            auto next_avx512 = avx512_rng.next8();
+#endif
+
+            for (auto j = 0; j < 8; j++)
+            {
+                std::copy(reference_lanes[j].begin(), reference_lanes[j].end(), Xoshiro256PlusReference::s);
+
+                uint64_t next_ref = Xoshiro256PlusReference::next();
+
+                std::copy(Xoshiro256PlusReference::s, Xoshiro256PlusReference::s + 4, reference_lanes[j].begin());
+
+                REQUIRE(next_ref == next_serial[j]);
+                REQUIRE(next_ref == next_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(next_ref == next_avx512[j]);
+#endif
+            }
+        }
+    }
+
+    SECTION("next4 Shares Lanes With next8")
+    {
+        Xoshiro256PlusSerialEightLanes serial_rng(SEED);
+        Xoshiro256PlusAVX2EightLanes avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto next_four_serial = serial_rng.next4();
+            auto next_four_avx2 = avx2_rng.next4();
+#ifdef __AVX512_AVAILABLE__
+            auto next_four_avx512 = avx512_rng.next4();
+#endif
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(next_four_serial[j] == next_four_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(next_four_serial[j] == next_four_avx512[j]);
+#endif
+            }
+
+            auto next_eight_serial = serial_rng.next8();
+            auto next_eight_avx2 = avx2_rng.next8();
+#ifdef __AVX512_AVAILABLE__
+            auto next_eight_avx512 = avx512_rng.next8();
+#endif
+
+            for (auto j = 0; j < 8; j++)
+            {
+                REQUIRE(next_eight_serial[j] == next_eight_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(next_eight_serial[j] == next_eight_avx512[j]);
+#endif
+            }
+        }
+    }
+
+    SECTION("Bounded and Double next8 Match")
+    {
+        Xoshiro256PlusSerialEightLanes serial_rng(SEED);
+        Xoshiro256PlusAVX2EightLanes avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto bounded_serial = serial_rng.next8(200, 300);
+            auto bounded_avx2 = avx2_rng.next8(200, 300);
+            auto doubles_serial = serial_rng.dnext8();
+            auto doubles_avx2 = avx2_rng.dnext8();
+            auto bounded_doubles_serial = serial_rng.dnext8(-5, 5);
+            auto bounded_doubles_avx2 = avx2_rng.dnext8(-5, 5);
+#ifdef __AVX512_AVAILABLE__
+            auto bounded_avx512 = avx512_rng.next8(200, 300);
+            auto doubles_avx512 = avx512_rng.dnext8();
+            auto bounded_doubles_avx512 = avx512_rng.dnext8(-5, 5);
+#endif
+
+            for (auto j = 0; j < 8; j++)
+            {
+                REQUIRE(((bounded_serial[j] >= 200) && (bounded_serial[j] < 300)));
+                REQUIRE(((doubles_serial[j] >= 0) && (doubles_serial[j] < 1)));
+                REQUIRE(((bounded_doubles_serial[j] >= -5) && (bounded_doubles_serial[j] < 5)));
+
+                REQUIRE(bounded_serial[j] == bounded_avx2[j]);
+                REQUIRE(doubles_serial[j] == doubles_avx2[j]);
+                REQUIRE(bounded_doubles_serial[j] == bounded_doubles_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(bounded_serial[j] == bounded_avx512[j]);
+                REQUIRE(doubles_serial[j] == doubles_avx512[j]);
+                REQUIRE(bounded_doubles_serial[j] == bounded_doubles_avx512[j]);
+#endif
+            }
+        }
+    }
+
+    SECTION("Copy With Jump Matches")
+    {
+        Xoshiro256PlusSerialEightLanes serial_rng(SEED);
+        Xoshiro256PlusSerialEightLanes serial_copy(serial_rng, Xoshiro256PlusSerialEightLanes::JumpOnCopy::Short);
+        Xoshiro256PlusSerialEightLanes serial_long_copy(serial_rng, Xoshiro256PlusSerialEightLanes::JumpOnCopy::Long);
+        Xoshiro256PlusAVX2EightLanes avx2_rng(SEED);
+        Xoshiro256PlusAVX2EightLanes avx2_copy(avx2_rng, Xoshiro256PlusAVX2EightLanes::JumpOnCopy::Short);
+        Xoshiro256PlusAVX2EightLanes avx2_long_copy(avx2_rng, Xoshiro256PlusAVX2EightLanes::JumpOnCopy::Long);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+        Xoshiro256PlusAVX512 avx512_copy(avx512_rng, Xoshiro256PlusAVX512::JumpOnCopy::Short);
+        Xoshiro256PlusAVX512 avx512_long_copy(avx512_rng, Xoshiro256PlusAVX512::JumpOnCopy::Long);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(serial_long_copy.next() == avx2_long_copy.next());
+
+            auto next_serial = serial_copy.next8();
+            auto next_avx2 = avx2_copy.next8();
+            auto next_serial_long = serial_long_copy.next8();
+            auto next_avx2_long = avx2_long_copy.next8();
+#ifdef __AVX512_AVAILABLE__
+            REQUIRE(serial_copy.next() == avx512_copy.next());
+
+            auto next_avx512 = avx512_copy.next8();
+            auto next_avx512_long = avx512_long_copy.next8();
+#endif
+
+            for (auto j = 0; j < 8; j++)
+            {
+                REQUIRE(next_serial[j] == next_avx2[j]);
+                REQUIRE(next_serial_long[j] == next_avx2_long[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(next_serial[j] == next_avx512[j]);
+                REQUIRE(next_serial_long[j] == next_avx512_long[j]);
+#endif
+            }
+        }
+    }
+
+#ifdef __AVX512_AVAILABLE__
+    SECTION("AVX512 Fill Matches next4")
+    {
+        constexpr size_t FILL_SIZE = 1003;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+
+        uint64_t buffer[FILL_SIZE];
+
+        avx512_rng.fill(buffer, FILL_SIZE);
+
+        for (auto i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto next_four = serial_rng.next4();
+
+            for (auto j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(buffer[i + j] == next_four[j]);
+            }
+        }
+    }
+#endif
+}
+
+TEST_CASE("Sixteen Lanes", "[basic]")
+{
+    SECTION("Streams Match - next16")
+    {
+        SEFUtility::RNG::SplitMix64 split_mix(SEED);
+
+        Xoshiro256PlusReference::s[0] = split_mix.next();
+        Xoshiro256PlusReference::s[1] = split_mix.next();
+        Xoshiro256PlusReference::s[2] = split_mix.next();
+        Xoshiro256PlusReference::s[3] = split_mix.next();
+
+        std::array<std::array<uint64_t, 4>, 16> reference_lanes;
+
+        for (auto& lane : reference_lanes)
+        {
+            Xoshiro256PlusReference::long_jump();
+
+            std::copy(Xoshiro256PlusReference::s, Xoshiro256PlusReference::s + 4, lane.begin());
+        }
+
+        Xoshiro256PlusSerialSixteenLanes serial_rng(SEED);
+        Xoshiro256PlusAVX2SixteenLanes avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512SixteenLanes avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto next_serial = serial_rng.next16();
+            auto next_avx2 = avx2_rng.next16();
+#ifdef __AVX512_AVAILABLE__
+            auto next_avx512 = avx512_rng.next16();
+#endif
+
+            for (auto j = 0; j < 16; j++)
+            {
+                std::copy(reference_lanes[j].begin(), reference_lanes[j].end(), Xoshiro256PlusReference::s);
+
+                uint64_t next_ref = Xoshiro256PlusReference::next();
+
+                std::copy(Xoshiro256PlusReference::s, Xoshiro256PlusReference::s + 4, reference_lanes[j].begin());
+
+                REQUIRE(next_ref == next_serial[j]);
+                REQUIRE(next_ref == next_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(next_ref == next_avx512[j]);
+#endif
+            }
+        }
+    }
+
+    SECTION("Mixed Widths Match")
+    {
+        Xoshiro256PlusSerialSixteenLanes serial_rng(SEED);
+        Xoshiro256PlusAVX2SixteenLanes avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512SixteenLanes avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto four_serial = serial_rng.next4();
+            auto four_avx2 = avx2_rng.next4();
+            auto eight_serial = serial_rng.dnext8(-1, 1);
+            auto eight_avx2 = avx2_rng.dnext8(-1, 1);
+            auto sixteen_serial = serial_rng.next16(10, 20);
+            auto sixteen_avx2 = avx2_rng.next16(10, 20);
+            auto sixteen_doubles_serial = serial_rng.dnext16();
+            auto sixteen_doubles_avx2 = avx2_rng.dnext16();
+#ifdef __AVX512_AVAILABLE__
+            auto four_avx512 = avx512_rng.next4();
+            auto eight_avx512 = avx512_rng.dnext8(-1, 1);
+            auto sixteen_avx512 = avx512_rng.next16(10, 20);
+            auto sixteen_doubles_avx512 = avx512_rng.dnext16();
+#endif
+
+            for (auto j = 0; j < 16; j++)
+            {
+                if (j < 4)
+                {
+                    REQUIRE(four_serial[j] == four_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                    REQUIRE(four_serial[j] == four_avx512[j]);
+#endif
+                }
+
+                if (j < 8)
+                {
+                    REQUIRE(eight_serial[j] == eight_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                    REQUIRE(eight_serial[j] == eight_avx512[j]);
+#endif
+                }
+
+                REQUIRE(((sixteen_serial[j] >= 10) && (sixteen_serial[j] < 20)));
+                REQUIRE(((sixteen_doubles_serial[j] >= 0) && (sixteen_doubles_serial[j] < 1)));
+
+                REQUIRE(sixteen_serial[j] == sixteen_avx2[j]);
+                REQUIRE(sixteen_doubles_serial[j] == sixteen_doubles_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(sixteen_serial[j] == sixteen_avx512[j]);
+                REQUIRE(sixteen_doubles_serial[j] == sixteen_doubles_avx512[j]);
+#endif
+            }
+        }
+    }
+}
+
+TEST_CASE("Jump Ahead", "[basic]")
+{
+    SECTION("Jump Polynomials Match Jump Constants")
+    {
+        using SEFUtility::RNG::JumpPolynomial;
+
+        const JumpPolynomial::Coefficients JUMP = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa,
+                                                   0x39abdc4529b1661c};
+        const JumpPolynomial::Coefficients LONG_JUMP = {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241,
+                                                        0x39109bb02acbe635};
+
+        const JumpPolynomial half_jump = JumpPolynomial::for_distance(__uint128_t(1) << 127);
+
+        REQUIRE(JumpPolynomial::for_jumps(1).coefficients() == JUMP);
+        REQUIRE(half_jump * half_jump == JumpPolynomial(JUMP));
+        REQUIRE(JumpPolynomial::for_long_jumps(1).coefficients() == LONG_JUMP);
+        REQUIRE(JumpPolynomial::for_jumps(4) == JumpPolynomial::for_jumps(1) * JumpPolynomial::for_jumps(3));
+        REQUIRE(JumpPolynomial::for_distance(0) == JumpPolynomial());
+    }
+
+    SECTION("discard Matches Stepping")
+    {
+        for (uint64_t distance : {0, 1, 3, 64, 255, 256, 1000})
+        {
+            Xoshiro256PlusSerialEightLanes serial_rng(SEED);
+            Xoshiro256PlusSerialEightLanes serial_discard(SEED);
+            Xoshiro256PlusAVX2EightLanes avx2_discard(SEED);
+#ifdef __AVX512_AVAILABLE__
+            Xoshiro256PlusAVX512 avx512_discard(SEED);
+#endif
+
+            for (uint64_t i = 0; i < distance; i++)
+            {
+                serial_rng.next();
+                serial_rng.next8();
+            }
+
+            serial_discard.discard(distance);
+            avx2_discard.discard(distance);
+#ifdef __AVX512_AVAILABLE__
+            avx512_discard.discard(distance);
+#endif
+
+            for (auto i = 0; i < NUM_SAMPLES; i++)
+            {
+                const uint64_t next_serial = serial_rng.next();
+
+                REQUIRE(next_serial == serial_discard.next());
+                REQUIRE(next_serial == avx2_discard.next());
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(next_serial == avx512_discard.next());
+#endif
+
+                auto eight_serial = serial_rng.next8();
+                auto eight_discard = serial_discard.next8();
+                auto eight_avx2 = avx2_discard.next8();
+#ifdef __AVX512_AVAILABLE__
+                auto eight_avx512 = avx512_discard.next8();
+#endif
+
+                for (auto j = 0; j < 8; j++)
+                {
+                    REQUIRE(eight_serial[j] == eight_discard[j]);
+                    REQUIRE(eight_serial[j] == eight_avx2[j]);
+#ifdef __AVX512_AVAILABLE__
+                    REQUIRE(eight_serial[j] == eight_avx512[j]);
+#endif
+                }
+            }
+        }
+    }
+
+    SECTION("discard_lanes Leaves next() in Place")
+    {
+        const __uint128_t distance = (__uint128_t(0x0000000000000123) << 64) | 0x456789abcdef0123;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2EightLanes avx2_eight_lanes_rng(SEED);
+        Xoshiro256PlusAVX2EightLanes discard_rng(SEED);
+        Xoshiro256PlusAVX2EightLanes reference_rng(SEED);
+
+        serial_rng.discard_lanes(distance);
+        avx2_rng.discard_lanes(distance);
+        avx2_eight_lanes_rng.discard_lanes(distance);
+        discard_rng.discard(distance);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            const uint64_t next_reference = reference_rng.next();
+
+            REQUIRE(serial_rng.next() == next_reference);
+            REQUIRE(avx2_rng.next() == next_reference);
+            REQUIRE(avx2_eight_lanes_rng.next() == next_reference);
+
+            auto four_serial = serial_rng.next4();
+            auto four_avx2 = avx2_rng.next4();
+            auto eight_lanes = avx2_eight_lanes_rng.next8();
+            auto eight_discard = discard_rng.next8();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_serial[j] == eight_discard[j]);
+                REQUIRE(four_avx2[j] == eight_discard[j]);
+            }
+
+            for (auto j = 0; j < 8; j++)
+            {
+                REQUIRE(eight_lanes[j] == eight_discard[j]);
+            }
+        }
+    }
+
+    SECTION("discard Distances Add")
+    {
+        const __uint128_t first_distance = (__uint128_t(0x0123456789abcdef) << 64) | 0xfedcba9876543210;
+        const __uint128_t second_distance = (__uint128_t(0x00000000deadbeef) << 64) | 0x0f0f0f0f0f0f0f0f;
+
+        Xoshiro256PlusAVX2 twice_rng(SEED);
+        Xoshiro256PlusAVX2 once_rng(SEED);
+
+        twice_rng.discard(first_distance);
+        twice_rng.discard(second_distance);
+        once_rng.discard(first_distance + second_distance);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(twice_rng.next() == once_rng.next());
+
+            auto four_twice = twice_rng.next4();
+            auto four_once = once_rng.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_twice[j] == four_once[j]);
+            }
+        }
+    }
+
+    SECTION("jump_streams Matches Jumps")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusSerial serial_one_jump(serial_rng, Xoshiro256PlusSerial::JumpOnCopy::Short);
+        Xoshiro256PlusSerial serial_two_jumps(serial_one_jump, Xoshiro256PlusSerial::JumpOnCopy::Short);
+        Xoshiro256PlusSerial serial_jumped(serial_two_jumps, Xoshiro256PlusSerial::JumpOnCopy::Short);
+        Xoshiro256PlusSerial serial_stream(SEED);
+        Xoshiro256PlusAVX2 avx2_stream(SEED);
+
+        serial_stream.jump_streams(3);
+        avx2_stream.jump_streams(3);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            const uint64_t next_jumped = serial_jumped.next();
+
+            REQUIRE(next_jumped == serial_stream.next());
+            REQUIRE(next_jumped == avx2_stream.next());
+
+            auto four_jumped = serial_jumped.next4();
+            auto four_serial = serial_stream.next4();
+            auto four_avx2 = avx2_stream.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_jumped[j] == four_serial[j]);
+                REQUIRE(four_jumped[j] == four_avx2[j]);
+            }
+        }
+    }
+
+    SECTION("jump_streams is Relative")
+    {
+        //  Jumps add up, and a jump after drawing values keeps the values already drawn.
+
+        Xoshiro256PlusAVX2 twice_rng(SEED);
+        Xoshiro256PlusAVX2 once_rng(SEED);
+
+        twice_rng.jump_streams(2);
+        twice_rng.jump_streams(3);
+        once_rng.jump_streams(5);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(twice_rng.next() == once_rng.next());
+            REQUIRE(twice_rng.next4()[0] == once_rng.next4()[0]);
+        }
+
+        Xoshiro256PlusSerial drawn_rng(SEED);
+        Xoshiro256PlusSerial undrawn_rng(SEED);
+
+        for (auto i = 0; i < 1000; i++)
+        {
+            drawn_rng.next();
+        }
+
+        drawn_rng.jump_streams(2);
+        undrawn_rng.jump_streams(2);
+        undrawn_rng.discard(1000);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(drawn_rng.next() == undrawn_rng.next());
+        }
+
+        Xoshiro256PlusSerial fresh_rng(SEED);
+
+        fresh_rng.jump_streams(2);
+
+        REQUIRE(drawn_rng.next() != fresh_rng.next());
+    }
+}
+
+TEST_CASE("Lazy Lane Initialization", "[basic]")
+{
+    //  Lanes derived on first use must match lanes derived on construction, whatever scalar calls, copies and jumps
+    //      come before that first use.
+
+    SECTION("Scalar Draws Before First next4")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusSerialLazy serial_scalar_first(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2Lazy avx2_scalar_first(SEED);
+
+        serial_rng.next4();
+        avx2_rng.next4();
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            const uint64_t next_serial = serial_rng.next();
+
+            REQUIRE(next_serial == serial_scalar_first.next());
+            REQUIRE(next_serial == avx2_rng.next());
+            REQUIRE(next_serial == avx2_scalar_first.next());
+        }
+
+        Xoshiro256PlusSerial serial_reference(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto four_reference = serial_reference.next4();
+            auto four_serial = serial_scalar_first.next4();
+            auto four_avx2 = avx2_scalar_first.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_reference[j] == four_serial[j]);
+                REQUIRE(four_reference[j] == four_avx2[j]);
+            }
+        }
+    }
+
+    SECTION("Copies and Jumps Before First Use")
+    {
+        Xoshiro256PlusSerialEightLanes eager_rng(SEED);
+        Xoshiro256PlusSerialEightLanesLazy lazy_rng(SEED);
+        Xoshiro256PlusAVX2EightLanesLazy avx2_lazy_rng(SEED);
+
+        eager_rng.next();
+        eager_rng.next8();
+        lazy_rng.next();
+        avx2_lazy_rng.next();
+
+        Xoshiro256PlusSerialEightLanes eager_copy(eager_rng, Xoshiro256PlusSerialEightLanes::JumpOnCopy::Long);
+        Xoshiro256PlusSerialEightLanesLazy lazy_copy(lazy_rng, Xoshiro256PlusSerialEightLanesLazy::JumpOnCopy::Long);
+        Xoshiro256PlusAVX2EightLanesLazy avx2_lazy_copy(avx2_lazy_rng,
+                                                        Xoshiro256PlusAVX2EightLanesLazy::JumpOnCopy::Long);
+
+        eager_copy.jump_streams(2);
+        lazy_copy.jump_streams(2);
+        avx2_lazy_copy.jump_streams(2);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            const uint64_t next_eager = eager_copy.next();
+
+            REQUIRE(next_eager == lazy_copy.next());
+            REQUIRE(next_eager == avx2_lazy_copy.next());
+        }
+
+        //  The eager RNG drew one set of eight before it was copied
+
+        lazy_copy.next8();
+        avx2_lazy_copy.next8();
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto eight_eager = eager_copy.next8();
+            auto eight_lazy = lazy_copy.next8();
+            auto eight_avx2 = avx2_lazy_copy.next8();
+
+            for (auto j = 0; j < 8; j++)
+            {
+                REQUIRE(eight_eager[j] == eight_lazy[j]);
+                REQUIRE(eight_eager[j] == eight_avx2[j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("State Layouts", "[basic]")
+{
+    SECTION("ScalarOnly Matches Serial")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusScalarOnly scalar_only_rng(SEED);
+
+        REQUIRE(sizeof(scalar_only_rng) == 32);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(serial_rng.next() == scalar_only_rng.next());
+            REQUIRE(serial_rng.dnext() == scalar_only_rng.dnext());
+            REQUIRE(serial_rng.next(10, 1000) == scalar_only_rng.next(10, 1000));
+        }
+
+        Xoshiro256PlusSerial serial_copy(serial_rng, Xoshiro256PlusSerial::JumpOnCopy::Long);
+        Xoshiro256PlusScalarOnly scalar_only_copy(scalar_only_rng, Xoshiro256PlusScalarOnly::JumpOnCopy::Long);
+
+        serial_copy.discard(12345);
+        scalar_only_copy.discard(12345);
+        serial_copy.jump_streams(3);
+        scalar_only_copy.jump_streams(3);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(serial_copy.next() == scalar_only_copy.next());
+        }
+    }
+
+    SECTION("Full and SIMDOnly AVX2 Match")
+    {
+        Xoshiro256PlusAVX2 simd_only_rng(SEED);
+        Xoshiro256PlusAVX2Full full_rng(SEED);
+
+        REQUIRE(sizeof(full_rng) - sizeof(simd_only_rng) == 4 * 32);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(simd_only_rng.next() == full_rng.next());
+
+            auto four_simd_only = simd_only_rng.next4();
+            auto four_full = full_rng.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_simd_only[j] == four_full[j]);
+            }
+        }
+
+        Xoshiro256PlusAVX2 simd_only_copy(simd_only_rng, Xoshiro256PlusAVX2::JumpOnCopy::Short);
+        Xoshiro256PlusAVX2Full full_copy(full_rng, Xoshiro256PlusAVX2Full::JumpOnCopy::Short);
+
+        simd_only_copy.discard(999);
+        full_copy.discard(999);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto four_simd_only = simd_only_copy.next4();
+            auto four_full = full_copy.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_simd_only[j] == four_full[j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Generator Bank", "[basic]")
+{
+    //  An odd number of streams exercises the partial SIMD blocks at the end of the bank
+
+    constexpr size_t NUM_STREAMS = 37;
+
+    SECTION("Streams Match Single RNGs")
+    {
+        Xoshiro256PlusBankSerial serial_bank(NUM_STREAMS, SEED);
+        Xoshiro256PlusBankAVX2 avx2_bank(NUM_STREAMS, SEED);
+
+        std::vector<Xoshiro256PlusScalarOnly> single_rngs;
+
+        //  Reserved up front, the RNG copy constructor jumps so the generators must not be moved by the vector.
+
+        single_rngs.reserve(NUM_STREAMS);
+
+        for (size_t i = 0; i < NUM_STREAMS; i++)
+        {
+            single_rngs.emplace_back(Xoshiro256PlusBankSerial::stream_seed(SEED, i));
+        }
+
+        std::vector<uint64_t> serial_values(NUM_STREAMS + 1, 0);
+        std::vector<uint64_t> avx2_values(NUM_STREAMS + 1, 0);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            serial_bank.next(serial_values.data());
+            avx2_bank.next(avx2_values.data() + 1);
+
+            for (size_t j = 0; j < NUM_STREAMS; j++)
+            {
+                const uint64_t next_single = single_rngs[j].next();
+
+                REQUIRE(next_single == serial_values[j]);
+                REQUIRE(next_single == avx2_values[j + 1]);
+            }
+
+            REQUIRE(serial_values[NUM_STREAMS] == 0);
+            REQUIRE(avx2_values[0] == 0);
+        }
+
+        REQUIRE(avx2_bank.stream_state(NUM_STREAMS - 1) == serial_bank.stream_state(NUM_STREAMS - 1));
+    }
+
+    SECTION("Streams Seeded From Ids")
+    {
+        std::vector<uint64_t> ids(NUM_STREAMS);
+
+        for (size_t i = 0; i < NUM_STREAMS; i++)
+        {
+            ids[i] = (i * 1000003) + 17;
+        }
+
+        Xoshiro256PlusBankAVX2 bank_from_ids(ids.data(), NUM_STREAMS, SEED);
+        Xoshiro256PlusBankAVX2 reseeded_bank(NUM_STREAMS, SEED);
+
+        for (size_t i = 0; i < NUM_STREAMS; i++)
+        {
+            reseeded_bank.seed_stream(i, ids[i]);
+        }
+
+        Xoshiro256PlusScalarOnly single_rng(Xoshiro256PlusBankAVX2::stream_seed(SEED, ids[5]));
+
+        std::vector<uint64_t> values_from_ids(NUM_STREAMS);
+        std::vector<uint64_t> reseeded_values(NUM_STREAMS);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            bank_from_ids.next(values_from_ids.data());
+            reseeded_bank.next(reseeded_values.data());
+
+            REQUIRE(values_from_ids == reseeded_values);
+            REQUIRE(values_from_ids[5] == single_rng.next());
+        }
+    }
+
+#ifdef __AVX512_AVAILABLE__
+    SECTION("AVX512 Bank Matches Serial Bank")
+    {
+        Xoshiro256PlusBankSerial serial_bank(NUM_STREAMS, SEED);
+        Xoshiro256PlusBankAVX512 avx512_bank(NUM_STREAMS, SEED);
+
+        std::vector<uint64_t> serial_values(NUM_STREAMS);
+        std::vector<uint64_t> avx512_values(NUM_STREAMS + 1, 0);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            serial_bank.next(serial_values.data());
+            avx512_bank.next(avx512_values.data());
+
+            REQUIRE(avx512_values[NUM_STREAMS] == 0);
+
+            avx512_values.pop_back();
+            REQUIRE(serial_values == avx512_values);
+            avx512_values.push_back(0);
+        }
+    }
+#endif
+}
+
+TEST_CASE("Unbiased Integer Bounding", "[basic]")
+{
+    //  A range of 3 * 2^30 splits 2^32 unevenly, with multiply and shift bounding every value divisible by three has
+    //      two preimages and the others one - so half of the values are divisible by three instead of a third.
+
+    constexpr uint32_t UNEVEN_RANGE = 3221225472;
+    constexpr size_t NUM_UNEVEN_SAMPLES = 30000;
+
+    SECTION("Unbiased Matches Biased For Small Ranges")
+    {
+        Xoshiro256PlusAVX2 biased_rng(SEED);
+        Xoshiro256PlusAVX2 unbiased_rng(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(biased_rng.next(10, 1000) == unbiased_rng.next_unbiased(10, 1000));
+
+            auto four_biased = biased_rng.next4(10, 1000);
+            auto four_unbiased = unbiased_rng.next4_unbiased(10, 1000);
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_biased[j] == four_unbiased[j]);
+            }
+        }
+    }
+
+    SECTION("Serial and AVX Unbiased Bounding Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto four_serial = serial_rng.next4_unbiased(7, UNEVEN_RANGE + 7);
+            auto four_avx2 = avx2_rng.next4_unbiased(7, UNEVEN_RANGE + 7);
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_serial[j] == four_avx2[j]);
+                REQUIRE(four_serial[j] >= 7);
+                REQUIRE(four_serial[j] < UNEVEN_RANGE + 7);
+            }
+
+            //  The serial RNG exercises the scalar rejection loop
+
+            const uint64_t next_serial = serial_rng.next_unbiased(7, UNEVEN_RANGE + 7);
+
+            REQUIRE(next_serial == avx2_rng.next_unbiased(7, UNEVEN_RANGE + 7));
+            REQUIRE(next_serial >= 7);
+            REQUIRE(next_serial < UNEVEN_RANGE + 7);
+        }
+    }
+
+    SECTION("Unbiased Bounding Removes The Bias")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        size_t biased_divisible = 0;
+        size_t unbiased_divisible = 0;
+        size_t four_unbiased_divisible = 0;
+
+        for (size_t i = 0; i < NUM_UNEVEN_SAMPLES; i++)
+        {
+            biased_divisible += (rng.next(0, UNEVEN_RANGE) % 3) == 0;
+            unbiased_divisible += (rng.next_unbiased(0, UNEVEN_RANGE) % 3) == 0;
+            four_unbiased_divisible += (rng.next4_unbiased(0, UNEVEN_RANGE)[i % 4] % 3) == 0;
+        }
+
+        REQUIRE(std::abs((biased_divisible / (double)NUM_UNEVEN_SAMPLES) - 0.5) < 0.02);
+        REQUIRE(std::abs((unbiased_divisible / (double)NUM_UNEVEN_SAMPLES) - (1.0 / 3.0)) < 0.02);
+        REQUIRE(std::abs((four_unbiased_divisible / (double)NUM_UNEVEN_SAMPLES) - (1.0 / 3.0)) < 0.02);
+    }
+}
+
+TEST_CASE("64 Bit Integer Bounding", "[basic]")
+{
+    SECTION("Serial and AVX 64 Bit Bounding Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        //  Bounds chosen to put all of the partial products and the carries between them to work
+
+        const std::array<std::pair<uint64_t, uint64_t>, 5> bounds = {{{0, 10},
+                                                                       {1000, 0x100000000},
+                                                                       {0x123456789, 0x7FFFFFFFFFFFFFFF},
+                                                                       {0, 0xFFFFFFFFFFFFFFFF},
+                                                                       {0xFFFFFFFF00000000, 0xFFFFFFFFFFFFFFFF}}};
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            for (const auto& [lower, upper] : bounds)
+            {
+                auto four_serial = serial_rng.next4_64(lower, upper);
+                auto four_avx2 = avx2_rng.next4_64(lower, upper);
+                auto four_reference = reference_rng.next4();
+
+                for (auto j = 0; j < 4; j++)
+                {
+                    const uint64_t expected =
+                        (uint64_t)(((__uint128_t)four_reference[j] * (upper - lower)) >> 64) + lower;
+
+                    REQUIRE(four_serial[j] == expected);
+                    REQUIRE(four_avx2[j] == expected);
+                    REQUIRE(four_avx2[j] >= lower);
+                    REQUIRE(four_avx2[j] < upper);
+                }
+
+                const uint64_t next_serial = serial_rng.next_64(lower, upper);
+
+                REQUIRE(next_serial == avx2_rng.next_64(lower, upper));
+                REQUIRE(next_serial == (uint64_t)(((__uint128_t)reference_rng.next() * (upper - lower)) >> 64) + lower);
+            }
+        }
+    }
+
+    SECTION("Range of 2^32 Takes The High Bits")
+    {
+        //  With a range of 2^32 the high half of the product is just the top 32 bits of the value
+
+        Xoshiro256PlusAVX2 rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto four_bounded = rng.next4_64(5, 0x100000005);
+            auto four_reference = reference_rng.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_bounded[j] == (four_reference[j] >> 32) + 5);
+            }
+        }
+    }
+}
+
+TEST_CASE("Per Lane Integer Bounding", "[basic]")
+{
+    //  Fisher-Yates style bounds, a different upper bound in every lane, plus lanes with ranges large enough to
+    //      reject regularly in the unbiased calls
+
+    SECTION("Per Lane Bounds Match Scalar Draws")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        for (uint32_t i = 0; i < NUM_SAMPLES; i++)
+        {
+            const std::array<uint32_t, 4> lower_bounds = {0, 0, 0, 0};
+            const std::array<uint32_t, 4> upper_bounds = {i + 1, i + 2, i + 3, i + 4};
+
+            auto four_serial = serial_rng.next4(lower_bounds, upper_bounds);
+            auto four_avx2 =
+                avx2_rng.next4(_mm256_set_epi64x(0, 0, 0, 0), _mm256_set_epi64x(i + 4, i + 3, i + 2, i + 1));
+            auto four_reference = reference_rng.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                const uint64_t expected =
+                    (((uint64_t)((uint32_t)four_reference[j]) * (uint64_t)upper_bounds[j]) >> 32);
+
+                REQUIRE(four_serial[j] == expected);
+                REQUIRE(four_avx2[j] == expected);
+            }
+        }
+    }
+
+    SECTION("Uniform Per Lane Bounds Match Broadcast Bounds")
+    {
+        Xoshiro256PlusAVX2 broadcast_rng(SEED);
+        Xoshiro256PlusAVX2 per_lane_rng(SEED);
+
+        const std::array<uint32_t, 4> lower_bounds = {7, 7, 7, 7};
+        const std::array<uint32_t, 4> upper_bounds = {3000000007, 3000000007, 3000000007, 3000000007};
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto four_broadcast = broadcast_rng.next4(7, 3000000007);
+            auto four_per_lane = per_lane_rng.next4(lower_bounds, upper_bounds);
+
+            auto four_broadcast_unbiased = broadcast_rng.next4_unbiased(7, 3000000007);
+            auto four_per_lane_unbiased = per_lane_rng.next4_unbiased(lower_bounds, upper_bounds);
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_broadcast[j] == four_per_lane[j]);
+                REQUIRE(four_broadcast_unbiased[j] == four_per_lane_unbiased[j]);
+            }
+        }
+    }
+
+    SECTION("Serial and AVX Unbiased Per Lane Bounds Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+
+        const std::array<uint32_t, 4> lower_bounds = {0, 100, 1000000, 5};
+        const std::array<uint32_t, 4> upper_bounds = {10, 3000000000, 4000000000, 2147483653};
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto four_serial = serial_rng.next4_unbiased(lower_bounds, upper_bounds);
+            auto four_avx2 = avx2_rng.next4_unbiased(lower_bounds, upper_bounds);
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_serial[j] == four_avx2[j]);
+                REQUIRE(four_avx2[j] >= lower_bounds[j]);
+                REQUIRE(four_avx2[j] < upper_bounds[j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Compile Time Integer Bounding", "[basic]")
+{
+    SECTION("Compile Time Bounds Match Runtime Bounds")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusSerial serial_runtime_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_runtime_rng(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(avx2_rng.next<1, 7>() == avx2_runtime_rng.next(1, 7));
+            REQUIRE(avx2_rng.next<16, 80>() == avx2_runtime_rng.next(16, 80));
+            REQUIRE(avx2_rng.next<5, 6>() == avx2_runtime_rng.next(5, 6));
+            REQUIRE(avx2_rng.next_unbiased<7, 3221225479>() == avx2_runtime_rng.next_unbiased(7, 3221225479));
+            REQUIRE(avx2_rng.next_unbiased<0, 1024>() == avx2_runtime_rng.next_unbiased(0, 1024));
+
+            auto four_serial = serial_rng.next4<1, 7>();
+            auto four_serial_runtime = serial_runtime_rng.next4(1, 7);
+            auto four_avx2 = avx2_rng.next4<1, 7>();
+            auto four_avx2_runtime = avx2_runtime_rng.next4(1, 7);
+            auto four_power_of_two = avx2_rng.next4<3, 259>();
+            auto four_power_of_two_runtime = avx2_runtime_rng.next4(3, 259);
+            auto four_unbiased = avx2_rng.next4_unbiased<7, 3221225479>();
+            auto four_unbiased_runtime = avx2_runtime_rng.next4_unbiased(7, 3221225479);
+            auto four_serial_unbiased = serial_rng.next4_unbiased<7, 3221225479>();
+            auto four_serial_unbiased_runtime = serial_runtime_rng.next4_unbiased(7, 3221225479);
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_serial[j] == four_serial_runtime[j]);
+                REQUIRE(four_avx2[j] == four_avx2_runtime[j]);
+                REQUIRE(four_power_of_two[j] == four_power_of_two_runtime[j]);
+                REQUIRE(four_unbiased[j] == four_unbiased_runtime[j]);
+                REQUIRE(four_serial_unbiased[j] == four_serial_unbiased_runtime[j]);
+            }
+        }
+    }
+
+    SECTION("UniformInt Power Of Two Takes Bits From One Draw")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        SEFUtility::RNG::UniformInt<10, 26> sixteen_values;
+
+        REQUIRE(sixteen_values.VALUES_PER_DRAW == 16);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            const uint64_t reference = reference_rng.next();
+
+            for (auto j = 0; j < 16; j++)
+            {
+                REQUIRE(sixteen_values(rng) == ((reference >> (60 - (4 * j))) & 0xF) + 10);
+            }
+        }
+
+        REQUIRE(rng.next() == reference_rng.next());
+    }
+
+    SECTION("UniformInt Small Ranges Are Uniform")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        SEFUtility::RNG::UniformInt<1, 7> die;
+
+        REQUIRE(die.VALUES_PER_DRAW == 11);
+
+        constexpr size_t NUM_ROLLS = 60000;
+        std::array<size_t, 7> counts = {0, 0, 0, 0, 0, 0, 0};
+
+        for (size_t i = 0; i < NUM_ROLLS; i++)
+        {
+            const uint64_t roll = die(rng);
+
+            REQUIRE(roll >= 1);
+            REQUIRE(roll < 7);
+
+            counts[roll]++;
+        }
+
+        for (auto face = 1; face < 7; face++)
+        {
+            REQUIRE(std::abs((counts[face] / (double)NUM_ROLLS) - (1.0 / 6.0)) < 0.01);
+        }
+    }
+
+    SECTION("UniformInt Large Ranges Match Compile Time Bounds")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        SEFUtility::RNG::UniformInt<0, 100000> bucket;
+        SEFUtility::RNG::UniformInt<0, 3221225472, true> unbiased_bucket;
+        SEFUtility::RNG::UniformInt<1, 7, true> unbiased_die;
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            REQUIRE(bucket(rng) == reference_rng.next<0, 100000>());
+            REQUIRE(unbiased_bucket(rng) == reference_rng.next_unbiased<0, 3221225472>());
+            REQUIRE(unbiased_die(rng) == reference_rng.next_unbiased<1, 7>());
+
+            auto four_bucket = bucket.next4(rng);
+            auto four_reference = reference_rng.next4<0, 100000>();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(four_bucket[j] == four_reference[j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Normal Distribution", "[basic]")
+{
+    typedef SEFUtility::RNG::NormalZiggurat Ziggurat;
+
+    constexpr size_t NUM_NORMALS = 400000;
+
+    SECTION("Ziggurat Tables")
+    {
+        REQUIRE(Ziggurat::X[1] == Ziggurat::R);
+        REQUIRE(Ziggurat::X[Ziggurat::NUM_LAYERS] == 0.0);
+        REQUIRE(Ziggurat::X[0] > Ziggurat::R);
+
+        for (size_t i = 1; i < Ziggurat::NUM_LAYERS; i++)
+        {
+            REQUIRE(Ziggurat::X[i + 1] < Ziggurat::X[i]);
+
+            //  Every layer has area V, the top layer collects the rounding of the recurrence
+
+            const double area = Ziggurat::X[i] * (std::exp(-0.5 * Ziggurat::X[i + 1] * Ziggurat::X[i + 1]) -
+                                                  std::exp(-0.5 * Ziggurat::X[i] * Ziggurat::X[i]));
+
+            REQUIRE(std::abs(area - Ziggurat::V) < 1e-10);
+        }
+    }
+
+    SECTION("Serial and AVX2 Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_NORMALS / 4; i++)
+        {
+            auto serial_values = serial_rng.normal4(1.5, 3.0);
+            auto avx2_values = avx2_rng.normal4(1.5, 3.0);
+#ifdef __AVX512_AVAILABLE__
+            auto avx512_values = avx512_rng.normal4(1.5, 3.0);
+#endif
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(serial_values[j] == avx2_values[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(serial_values[j] == avx512_values[j]);
+#endif
+            }
+        }
+
+        REQUIRE(serial_rng.normal() == avx2_rng.normal());
+        REQUIRE(serial_rng.next4()[2] == avx2_rng.next4()[2]);
+    }
+
+    SECTION("Fill Matches Four at a Time")
+    {
+        constexpr size_t FILL_SIZE = 1003;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        std::vector<double> serial_buffer(FILL_SIZE);
+        std::vector<double> avx2_buffer(FILL_SIZE);
+
+        serial_rng.fill_normal(serial_buffer.data(), FILL_SIZE, -2.0, 0.5);
+        avx2_rng.fill_normal(avx2_buffer.data(), FILL_SIZE, -2.0, 0.5);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.normal4(-2.0, 0.5);
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_buffer[i + j] == four_values[j]);
+                REQUIRE(avx2_buffer[i + j] == four_values[j]);
+            }
+        }
+
+        REQUIRE(avx2_rng.next4()[0] == reference_rng.next4()[0]);
+    }
+
+    SECTION("Moments and Tails")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> values(NUM_NORMALS);
+
+        rng.fill_normal(values.data(), NUM_NORMALS);
+
+        double sum = 0;
+        double sum_of_squares = 0;
+        size_t within_one = 0;
+        size_t beyond_r = 0;
+
+        for (auto value : values)
+        {
+            sum += value;
+            sum_of_squares += value * value;
+            within_one += std::abs(value) < 1.0;
+            beyond_r += std::abs(value) > Ziggurat::R;
+        }
+
+        const double mean = sum / NUM_NORMALS;
+
+        REQUIRE(std::abs(mean) < 0.01);
+        REQUIRE(std::abs((sum_of_squares / NUM_NORMALS) - (mean * mean) - 1.0) < 0.01);
+        REQUIRE(std::abs((within_one / (double)NUM_NORMALS) - 0.682689) < 0.005);
+
+        //  P(|x| > R) is about 2.6e-4, so roughly a hundred tail values are expected
+
+        REQUIRE(beyond_r > 50);
+        REQUIRE(beyond_r < 200);
+    }
+
+    SECTION("Scalar Normal")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        double sum = 0;
+        double sum_of_squares = 0;
+
+        for (auto i = 0; i < NUM_NORMALS; i++)
+        {
+            const double value = rng.normal(10.0, 2.0);
+
+            sum += value;
+            sum_of_squares += value * value;
+        }
+
+        const double mean = sum / NUM_NORMALS;
+
+        REQUIRE(std::abs(mean - 10.0) < 0.02);
+        REQUIRE(std::abs((sum_of_squares / NUM_NORMALS) - (mean * mean) - 4.0) < 0.04);
+    }
+
+    SECTION("Scalar Normal Draw Order")
+    {
+        //  Replays normal() from next() to pin the order of its draws, the tail in particular takes the first of
+        //      each pair of draws for x and the second for y.
+
+        auto unit = [](uint64_t draw) {
+            const uint64_t bits = (draw >> 12) | (UINT64_C(0x3FF) << 52);
+            double value;
+
+            memcpy(&value, &bits, sizeof(value));
+
+            return value;
+        };
+
+        auto open_unit = [](uint64_t draw) { return ((draw >> 11) + 1) * 0x1.0p-53; };
+
+        Xoshiro256PlusSerial rng(SEED);
+        Xoshiro256PlusSerial reference_rng(SEED);
+
+        size_t num_tail_values = 0;
+
+        for (auto i = 0; i < NUM_NORMALS; i++)
+        {
+            double expected;
+
+            while (true)
+            {
+                const uint64_t draw = reference_rng.next();
+                const size_t layer = (draw >> 4) & (Ziggurat::NUM_LAYERS - 1);
+                const double u = (unit(draw) + unit(draw)) - 3.0;
+                const double x = u * Ziggurat::X[layer];
+
+                if (std::abs(u) < Ziggurat::RATIO[layer])
+                {
+                    expected = x;
+                    break;
+                }
+
+                if (layer == 0)
+                {
+                    double tail_x;
+                    double tail_y;
+
+                    do
+                    {
+                        const uint64_t first_draw = reference_rng.next();
+                        const uint64_t second_draw = reference_rng.next();
+
+                        tail_x = -std::log(open_unit(first_draw)) / Ziggurat::R;
+                        tail_y = -std::log(open_unit(second_draw));
+                    } while ((tail_y + tail_y) < (tail_x * tail_x));
+
+                    expected = x < 0 ? -(Ziggurat::R + tail_x) : Ziggurat::R + tail_x;
+                    num_tail_values++;
+                    break;
+                }
+
+                const double f_outer = std::exp(-0.5 * ((Ziggurat::X[layer] * Ziggurat::X[layer]) - (x * x)));
+                const double f_inner = std::exp(-0.5 * ((Ziggurat::X[layer + 1] * Ziggurat::X[layer + 1]) - (x * x)));
+
+                if (f_outer + ((unit(reference_rng.next()) - 1.0) * (f_inner - f_outer)) < 1.0)
+                {
+                    expected = x;
+                    break;
+                }
+            }
+
+            REQUIRE(rng.normal() == expected);
+        }
+
+        REQUIRE(num_tail_values > 0);
+    }
+}
+
+TEST_CASE("Exponential and Geometric Distributions", "[basic]")
+{
+    constexpr size_t NUM_VALUES = 400000;
+
+    SECTION("Exponential Serial and AVX2 Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_VALUES / 4; i++)
+        {
+            auto serial_values = serial_rng.exponential4(2.5);
+            auto avx2_values = avx2_rng.exponential4(2.5);
+#ifdef __AVX512_AVAILABLE__
+            auto avx512_values = avx512_rng.exponential4(2.5);
+#endif
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(serial_values[j] == avx2_values[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(serial_values[j] == avx512_values[j]);
+#endif
+            }
+        }
+
+        REQUIRE(serial_rng.exponential(2.5) == avx2_rng.exponential(2.5));
+    }
+
+    SECTION("Exponential Matches std::log")
+    {
+        Xoshiro256PlusSerial rng(SEED);
+        Xoshiro256PlusSerial reference_rng(SEED);
+
+        for (auto i = 0; i < NUM_VALUES / 4; i++)
+        {
+            auto values = rng.exponential4(1.0);
+            auto uniforms = reference_rng.dnext4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                const double expected = -std::log(1.0 - uniforms[j]);
+
+                //  Within one ULP, expressed relative to the value
+
+                REQUIRE(std::abs(values[j] - expected) <= std::abs(expected) * 2.3e-16);
+            }
+        }
+    }
+
+    SECTION("Exponential Moments")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> values(NUM_VALUES);
+
+        rng.fill_exponential(values.data(), NUM_VALUES, 4.0);
+
+        double sum = 0;
+        double sum_of_squares = 0;
+
+        for (auto value : values)
+        {
+            REQUIRE(value >= 0.0);
+
+            sum += value;
+            sum_of_squares += value * value;
+        }
+
+        const double mean = sum / NUM_VALUES;
+
+        REQUIRE(std::abs(mean - 0.25) < 0.002);
+        REQUIRE(std::abs((sum_of_squares / NUM_VALUES) - (mean * mean) - 0.0625) < 0.001);
+    }
+
+    SECTION("Geometric Serial and AVX2 Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+
+        for (auto i = 0; i < NUM_VALUES / 4; i++)
+        {
+            auto serial_values = serial_rng.geometric4(0.1);
+            auto avx2_values = avx2_rng.geometric4(0.1);
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(serial_values[j] == avx2_values[j]);
+            }
+        }
+
+        REQUIRE(serial_rng.geometric(0.1) == avx2_rng.geometric(0.1));
+
+        auto always = avx2_rng.geometric4(1.0);
+
+        for (auto j = 0; j < 4; j++)
+        {
+            REQUIRE(always[j] == 0);
+        }
+    }
+
+    SECTION("Geometric Distribution")
+    {
+        constexpr double P = 0.2;
+
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> values(NUM_VALUES);
+
+        rng.fill_geometric(values.data(), NUM_VALUES, P);
+
+        std::array<size_t, 5> counts = {0, 0, 0, 0, 0};
+        double sum = 0;
+
+        for (auto value : values)
+        {
+            sum += value;
+
+            if (value < counts.size())
+            {
+                counts[value]++;
+            }
+        }
+
+        REQUIRE(std::abs((sum / NUM_VALUES) - ((1.0 - P) / P)) < 0.03);
+
+        for (size_t k = 0; k < counts.size(); k++)
+        {
+            REQUIRE(std::abs((counts[k] / (double)NUM_VALUES) - (P * std::pow(1.0 - P, k))) < 0.003);
+        }
+    }
+
+    SECTION("Fills Match Four at a Time")
+    {
+        constexpr size_t FILL_SIZE = 1003;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        std::vector<double> serial_doubles(FILL_SIZE);
+        std::vector<double> avx2_doubles(FILL_SIZE);
+        std::vector<uint64_t> serial_counts(FILL_SIZE);
+        std::vector<uint64_t> avx2_counts(FILL_SIZE);
+
+        serial_rng.fill_exponential(serial_doubles.data(), FILL_SIZE, 0.5);
+        avx2_rng.fill_exponential(avx2_doubles.data(), FILL_SIZE, 0.5);
+        serial_rng.fill_geometric(serial_counts.data(), FILL_SIZE, 0.3);
+        avx2_rng.fill_geometric(avx2_counts.data(), FILL_SIZE, 0.3);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.exponential4(0.5);
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_doubles[i + j] == four_values[j]);
+                REQUIRE(avx2_doubles[i + j] == four_values[j]);
+            }
+        }
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.geometric4(0.3);
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_counts[i + j] == four_values[j]);
+                REQUIRE(avx2_counts[i + j] == four_values[j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Poisson and Binomial Distributions", "[basic]")
+{
+    constexpr size_t NUM_COUNTS = 400000;
+
+    //  Compares the frequency of every count with a probability above 0.001 against the exact PMF, within four
+    //      standard deviations of the sample frequency, and the sample mean against the exact mean.
+
+    auto require_matches_pmf = [](const std::vector<uint64_t>& counts, auto log_pmf, double exact_mean)
+    {
+        std::vector<size_t> frequencies;
+        double sum = 0;
+
+        for (auto count : counts)
+        {
+            if (count >= frequencies.size())
+            {
+                frequencies.resize(count + 1, 0);
+            }
+
+            frequencies[count]++;
+            sum += count;
+        }
+
+        for (size_t k = 0; k < frequencies.size(); k++)
+        {
+            const double probability = std::exp(log_pmf((double)k));
+
+            if (probability > 0.001)
+            {
+                const double tolerance = 4 * std::sqrt(probability * (1 - probability) / counts.size());
+
+                REQUIRE(std::abs((frequencies[k] / (double)counts.size()) - probability) < tolerance);
+            }
+        }
+
+        REQUIRE(std::abs((sum / counts.size()) - exact_mean) < 0.01 * std::max(exact_mean, 1.0));
+    };
+
+    auto poisson_log_pmf = [](double mean)
+    { return [mean](double k) { return -mean + (k * std::log(mean)) - std::lgamma(k + 1); }; };
+
+    auto binomial_log_pmf = [](double n, double p)
+    {
+        return [n, p](double k) {
+            return std::lgamma(n + 1) - std::lgamma(k + 1) - std::lgamma(n - k + 1) + (k * std::log(p)) +
+                   ((n - k) * std::log1p(-p));
+        };
+    };
+
+    SECTION("Poisson Matches PMF")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> counts(NUM_COUNTS);
+
+        //  Inversion, then transformed rejection
+
+        for (auto mean : {0.5, 3.7, 9.99, 10.0, 42.5, 1000.0})
+        {
+            rng.fill_poisson(counts.data(), NUM_COUNTS, mean);
+
+            require_matches_pmf(counts, poisson_log_pmf(mean), mean);
+        }
+
+        rng.fill_poisson(counts.data(), NUM_COUNTS, 0.0);
+
+        REQUIRE(std::all_of(counts.begin(), counts.end(), [](uint64_t count) { return count == 0; }));
+    }
+
+    SECTION("Binomial Matches PMF")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> counts(NUM_COUNTS);
+
+        //  Inversion, transformed rejection and both flipped for p > 0.5
+
+        const std::vector<std::pair<uint64_t, double>> parameters = {
+            {20, 0.3}, {1000, 0.005}, {200, 0.4}, {5000, 0.5}, {30, 0.9}, {400, 0.75}};
+
+        for (auto [n, p] : parameters)
+        {
+            rng.fill_binomial(counts.data(), NUM_COUNTS, n, p);
+
+            REQUIRE(*std::max_element(counts.begin(), counts.end()) <= n);
+
+            require_matches_pmf(counts, binomial_log_pmf((double)n, p), n * p);
+        }
+
+        rng.fill_binomial(counts.data(), NUM_COUNTS, 17, 1.0);
+
+        REQUIRE(std::all_of(counts.begin(), counts.end(), [](uint64_t count) { return count == 17; }));
+
+        rng.fill_binomial(counts.data(), NUM_COUNTS, 17, 0.0);
+
+        REQUIRE(std::all_of(counts.begin(), counts.end(), [](uint64_t count) { return count == 0; }));
+    }
+
+    SECTION("Serial and AVX2 Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES * 10; i++)
+        {
+            for (auto mean : {2.5, 25.0})
+            {
+                auto serial_values = serial_rng.poisson4(mean);
+                auto avx2_values = avx2_rng.poisson4(mean);
+#ifdef __AVX512_AVAILABLE__
+                auto avx512_values = avx512_rng.poisson4(mean);
+#endif
+
+                for (auto j = 0; j < 4; j++)
+                {
+                    REQUIRE(serial_values[j] == avx2_values[j]);
+#ifdef __AVX512_AVAILABLE__
+                    REQUIRE(serial_values[j] == avx512_values[j]);
+#endif
+                }
+            }
+
+            for (auto p : {0.02, 0.35, 0.8})
+            {
+                auto serial_values = serial_rng.binomial4(500, p);
+                auto avx2_values = avx2_rng.binomial4(500, p);
+#ifdef __AVX512_AVAILABLE__
+                auto avx512_values = avx512_rng.binomial4(500, p);
+#endif
+
+                for (auto j = 0; j < 4; j++)
+                {
+                    REQUIRE(serial_values[j] == avx2_values[j]);
+#ifdef __AVX512_AVAILABLE__
+                    REQUIRE(serial_values[j] == avx512_values[j]);
+#endif
+                }
+            }
+        }
+    }
+
+    SECTION("Fills Match Four at a Time")
+    {
+        constexpr size_t FILL_SIZE = 1003;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        std::vector<uint64_t> serial_counts(FILL_SIZE);
+        std::vector<uint64_t> avx2_counts(FILL_SIZE);
+
+        serial_rng.fill_poisson(serial_counts.data(), FILL_SIZE, 60.0);
+        avx2_rng.fill_poisson(avx2_counts.data(), FILL_SIZE, 60.0);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.poisson4(60.0);
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_counts[i + j] == four_values[j]);
+                REQUIRE(avx2_counts[i + j] == four_values[j]);
+            }
+        }
+
+        serial_rng.fill_binomial(serial_counts.data(), FILL_SIZE, 40, 0.1);
+        avx2_rng.fill_binomial(avx2_counts.data(), FILL_SIZE, 40, 0.1);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.binomial4(40, 0.1);
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_counts[i + j] == four_values[j]);
+                REQUIRE(avx2_counts[i + j] == four_values[j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Gamma and Beta Distributions", "[basic]")
+{
+    constexpr size_t NUM_VALUES = 400000;
+
+    auto require_moments = [](const std::vector<double>& values, double exact_mean, double exact_variance)
+    {
+        double sum = 0;
+        double sum_of_squares = 0;
+
+        for (auto value : values)
+        {
+            REQUIRE(value >= 0.0);
+
+            sum += value;
+            sum_of_squares += value * value;
+        }
+
+        const double mean = sum / values.size();
+
+        REQUIRE(std::abs(mean - exact_mean) < 0.01 * exact_mean);
+        REQUIRE(std::abs((sum_of_squares / values.size()) - (mean * mean) - exact_variance) < 0.03 * exact_variance);
+    };
+
+    SECTION("Gamma Moments")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> values(NUM_VALUES);
+
+        //  Shapes below one are boosted from shape + 1
+
+        for (auto shape : {0.3, 1.0, 2.5, 50.0})
+        {
+            rng.fill_gamma(values.data(), NUM_VALUES, shape, 2.0);
+
+            require_moments(values, shape * 2.0, shape * 4.0);
+        }
+    }
+
+    SECTION("Beta Moments")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> values(NUM_VALUES);
+
+        for (auto [a, b] : std::vector<std::pair<double, double>>{{0.5, 0.5}, {2.0, 5.0}, {30.0, 7.0}})
+        {
+            rng.fill_beta(values.data(), NUM_VALUES, a, b);
+
+            REQUIRE(*std::max_element(values.begin(), values.end()) <= 1.0);
+
+            require_moments(values, a / (a + b), (a * b) / ((a + b) * (a + b) * (a + b + 1)));
+        }
+    }
+
+    SECTION("Serial and AVX2 Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES * 10; i++)
+        {
+            auto serial_gammas = serial_rng.gamma4(i % 2 ? 0.7 : 3.0, 1.5);
+            auto avx2_gammas = avx2_rng.gamma4(i % 2 ? 0.7 : 3.0, 1.5);
+            auto serial_betas = serial_rng.beta4(2.0, 0.8);
+            auto avx2_betas = avx2_rng.beta4(2.0, 0.8);
+#ifdef __AVX512_AVAILABLE__
+            auto avx512_gammas = avx512_rng.gamma4(i % 2 ? 0.7 : 3.0, 1.5);
+            auto avx512_betas = avx512_rng.beta4(2.0, 0.8);
+#endif
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(serial_gammas[j] == avx2_gammas[j]);
+                REQUIRE(serial_betas[j] == avx2_betas[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(serial_gammas[j] == avx512_gammas[j]);
+                REQUIRE(serial_betas[j] == avx512_betas[j]);
+#endif
+            }
+        }
+    }
+
+    SECTION("Fills Match Four at a Time")
+    {
+        constexpr size_t FILL_SIZE = 1003;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        std::vector<double> serial_values(FILL_SIZE);
+        std::vector<double> avx2_values(FILL_SIZE);
+
+        serial_rng.fill_gamma(serial_values.data(), FILL_SIZE, 4.0, 0.5);
+        avx2_rng.fill_gamma(avx2_values.data(), FILL_SIZE, 4.0, 0.5);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.gamma4(4.0, 0.5);
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_values[i + j] == four_values[j]);
+                REQUIRE(avx2_values[i + j] == four_values[j]);
+            }
+        }
+
+        serial_rng.fill_beta(serial_values.data(), FILL_SIZE, 3.0, 3.0);
+        avx2_rng.fill_beta(avx2_values.data(), FILL_SIZE, 3.0, 3.0);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.beta4(3.0, 3.0);
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_values[i + j] == four_values[j]);
+                REQUIRE(avx2_values[i + j] == four_values[j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Eight uint32s and Floats", "[basic]")
+{
+    SECTION("Halves of next4()")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto serial_values = serial_rng.next8_u32();
+            auto avx2_values = avx2_rng.next8_u32();
+            auto reference_values = reference_rng.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(serial_values[2 * j] == (uint32_t)reference_values[j]);
+                REQUIRE(serial_values[(2 * j) + 1] == (uint32_t)(reference_values[j] >> 32));
+                REQUIRE(avx2_values[2 * j] == (uint32_t)reference_values[j]);
+                REQUIRE(avx2_values[(2 * j) + 1] == (uint32_t)(reference_values[j] >> 32));
+            }
+        }
+    }
+
+    SECTION("Bounded and Floats Serial and AVX2 Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto serial_bounded = serial_rng.next8_u32(100, 3000000000);
+            auto avx2_bounded = avx2_rng.next8_u32(100, 3000000000);
+            auto reference_values = reference_rng.next4();
+
+            auto serial_floats = serial_rng.fnext8();
+            auto avx2_floats = avx2_rng.fnext8();
+
+            auto serial_bounded_floats = serial_rng.fnext8(-2.0f, 6.0f);
+            auto avx2_bounded_floats = avx2_rng.fnext8(-2.0f, 6.0f);
+
+#ifdef __AVX512_AVAILABLE__
+            auto avx512_bounded = avx512_rng.next8_u32(100, 3000000000);
+            auto avx512_floats = avx512_rng.fnext8();
+            auto avx512_bounded_floats = avx512_rng.fnext8(-2.0f, 6.0f);
+#endif
+
+            for (auto j = 0; j < 8; j++)
+            {
+                const uint32_t half = (uint32_t)(reference_values[j / 2] >> (32 * (j % 2)));
+
+                REQUIRE(avx2_bounded[j] == (uint32_t)(((uint64_t)half * (3000000000 - 100)) >> 32) + 100);
+                REQUIRE(serial_bounded[j] == avx2_bounded[j]);
+
+                REQUIRE(serial_floats[j] == avx2_floats[j]);
+                REQUIRE(avx2_floats[j] >= 0.0f);
+                REQUIRE(avx2_floats[j] < 1.0f);
+
+                REQUIRE(serial_bounded_floats[j] == avx2_bounded_floats[j]);
+                REQUIRE(avx2_bounded_floats[j] >= -2.0f);
+                REQUIRE(avx2_bounded_floats[j] < 6.0f);
+
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(avx512_bounded[j] == avx2_bounded[j]);
+                REQUIRE(avx512_floats[j] == avx2_floats[j]);
+                REQUIRE(avx512_bounded_floats[j] == avx2_bounded_floats[j]);
+#endif
+            }
+
+            reference_rng.next4();
+            reference_rng.next4();
+        }
+    }
+
+    SECTION("Floats Use the Upper 23 Bits")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto floats = rng.fnext8();
+            auto reference_values = reference_rng.next4();
+
+            for (auto j = 0; j < 8; j++)
+            {
+                const uint32_t half = (uint32_t)(reference_values[j / 2] >> (32 * (j % 2)));
+
+                REQUIRE(floats[j] == (half >> 9) * 0x1.0p-23f);
+            }
+        }
+    }
+
+    SECTION("Fills Match Eight at a Time")
+    {
+        constexpr size_t FILL_SIZE = 1003;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        //  Offset by one uint32 so the uint32 fill is not eight byte aligned
+
+        std::vector<uint32_t> serial_ints(FILL_SIZE + 1);
+        std::vector<uint32_t> avx2_ints(FILL_SIZE + 1);
+        std::vector<float> serial_floats(FILL_SIZE);
+        std::vector<float> avx2_floats(FILL_SIZE);
+
+        serial_rng.fill(serial_ints.data() + 1, FILL_SIZE);
+        avx2_rng.fill(avx2_ints.data() + 1, FILL_SIZE);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 8)
+        {
+            auto eight_values = reference_rng.next8_u32();
+
+            for (size_t j = 0; (j < 8) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_ints[i + j + 1] == eight_values[j]);
+                REQUIRE(avx2_ints[i + j + 1] == eight_values[j]);
+            }
+        }
+
+        serial_rng.fill(serial_floats.data(), FILL_SIZE);
+        avx2_rng.fill(avx2_floats.data(), FILL_SIZE);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 8)
+        {
+            auto eight_values = reference_rng.fnext8();
+
+            for (size_t j = 0; (j < 8) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_floats[i + j] == eight_values[j]);
+                REQUIRE(avx2_floats[i + j] == eight_values[j]);
+            }
+        }
+
+        serial_rng.fill(serial_floats.data(), FILL_SIZE, 10.0f, 20.0f);
+        avx2_rng.fill(avx2_floats.data(), FILL_SIZE, 10.0f, 20.0f);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 8)
+        {
+            auto eight_values = reference_rng.fnext8(10.0f, 20.0f);
+
+            for (size_t j = 0; (j < 8) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_floats[i + j] == eight_values[j]);
+                REQUIRE(avx2_floats[i + j] == eight_values[j]);
+            }
+        }
+
+        auto reference_next = reference_rng.next4();
+
+        REQUIRE(avx2_rng.next4()[1] == reference_next[1]);
+        REQUIRE(serial_rng.next4()[3] == reference_next[3]);
+    }
+}
+
+
+TEST_CASE("Unit Interval Doubles", "[basic]")
+{
+    using SEFUtility::RNG::UnitInterval;
+
+    //  Dense keeps the leading 53 significant bits of the draw
+
+    auto dense_reference = [](uint64_t draw) {
+        int dropped_bits = 0;
+
+        while ((draw >> dropped_bits) >= (UINT64_C(1) << 53))
+        {
+            dropped_bits++;
+        }
+
+        return std::ldexp((double)(draw >> dropped_bits), dropped_bits - 64);
+    };
+
+    SECTION("Conversions of next()")
+    {
+        Xoshiro256PlusSerial rng(SEED);
+        Xoshiro256PlusSerial reference_rng(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            uint64_t draw = reference_rng.next();
+            REQUIRE(rng.dnext<UnitInterval::ClosedOpen52>() == (draw >> 12) * 0x1.0p-52);
+
+            draw = reference_rng.next();
+            REQUIRE(rng.dnext<UnitInterval::ClosedOpen53>() == (draw >> 11) * 0x1.0p-53);
+
+            draw = reference_rng.next();
+            REQUIRE(rng.dnext<UnitInterval::Open>() == ((draw >> 12) + 0.5) * 0x1.0p-52);
+
+            draw = reference_rng.next();
+            REQUIRE(rng.dnext<UnitInterval::Closed>() == (((draw >> 10) + 1) >> 1) * 0x1.0p-53);
+
+            draw = reference_rng.next();
+            REQUIRE(rng.dnext<UnitInterval::Dense>() == dense_reference(draw));
+        }
+
+        REQUIRE(rng.dnext<UnitInterval::ClosedOpen52>() == reference_rng.dnext());
+    }
+
+    SECTION("Dense Values Below 2^-11")
+    {
+        //  Draws with the top twelve bits clear turn up about once in 4096, with the default conversion they would
+        //      be multiples of 2^-52.
+
+        Xoshiro256PlusSerial rng(SEED);
+
+        size_t num_small = 0;
+        size_t num_off_grid = 0;
+
+        for (auto i = 0; i < 100000; i++)
+        {
+            const double value = rng.dnext<UnitInterval::Dense>();
+
+            REQUIRE(value >= 0.0);
+            REQUIRE(value < 1.0);
+
+            if (value < 0x1.0p-11)
+            {
+                num_small++;
+                num_off_grid += (std::floor(value * 0x1.0p52) != value * 0x1.0p52) ? 1 : 0;
+            }
+        }
+
+        REQUIRE(num_small > 0);
+        REQUIRE(num_off_grid > 0);
+    }
+
+    SECTION("Serial, AVX2 and AVX512 Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        auto require_match = [&](auto interval, auto reference_value) {
+            constexpr UnitInterval INTERVAL = decltype(interval)::value;
+
+            auto serial_values = serial_rng.dnext4<INTERVAL>();
+            auto avx2_values = avx2_rng.dnext4<INTERVAL>();
+            auto reference_values = reference_rng.next4();
+#ifdef __AVX512_AVAILABLE__
+            auto avx512_values = avx512_rng.dnext4<INTERVAL>();
+#endif
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(avx2_values[j] == reference_value(reference_values[j]));
+                REQUIRE(serial_values[j] == avx2_values[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(avx512_values[j] == avx2_values[j]);
+#endif
+            }
+        };
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            require_match(std::integral_constant<UnitInterval, UnitInterval::ClosedOpen52>(),
+                          [](uint64_t draw) { return (draw >> 12) * 0x1.0p-52; });
+            require_match(std::integral_constant<UnitInterval, UnitInterval::ClosedOpen53>(),
+                          [](uint64_t draw) { return (draw >> 11) * 0x1.0p-53; });
+            require_match(std::integral_constant<UnitInterval, UnitInterval::Open>(),
+                          [](uint64_t draw) { return ((draw >> 12) + 0.5) * 0x1.0p-52; });
+            require_match(std::integral_constant<UnitInterval, UnitInterval::Closed>(),
+                          [](uint64_t draw) { return (((draw >> 10) + 1) >> 1) * 0x1.0p-53; });
+            require_match(std::integral_constant<UnitInterval, UnitInterval::Dense>(), dense_reference);
+        }
+    }
+
+    SECTION("Fills Match Four at a Time")
+    {
+        constexpr size_t FILL_SIZE = 1003;
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        std::vector<double> serial_values(FILL_SIZE);
+        std::vector<double> avx2_values(FILL_SIZE);
+
+        serial_rng.fill<UnitInterval::Open>(serial_values.data(), FILL_SIZE);
+        avx2_rng.fill<UnitInterval::Open>(avx2_values.data(), FILL_SIZE);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.dnext4<UnitInterval::Open>();
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_values[i + j] == four_values[j]);
+                REQUIRE(avx2_values[i + j] == four_values[j]);
+            }
+        }
+
+        serial_rng.fill<UnitInterval::Dense>(serial_values.data(), FILL_SIZE);
+        avx2_rng.fill<UnitInterval::Dense>(avx2_values.data(), FILL_SIZE);
+
+        for (size_t i = 0; i < FILL_SIZE; i += 4)
+        {
+            auto four_values = reference_rng.dnext4<UnitInterval::Dense>();
+
+            for (size_t j = 0; (j < 4) && (i + j < FILL_SIZE); j++)
+            {
+                REQUIRE(serial_values[i + j] == four_values[j]);
+                REQUIRE(avx2_values[i + j] == four_values[j]);
+            }
+        }
+
+        auto reference_next = reference_rng.next4();
+
+        REQUIRE(avx2_rng.next4()[2] == reference_next[2]);
+        REQUIRE(serial_rng.next4()[0] == reference_next[0]);
+    }
+}
+
+TEST_CASE("Bernoulli Bitmasks", "[basic]")
+{
+    constexpr size_t NUM_BITS = 1000003;
+
+    auto count_bits = [](const std::vector<uint64_t>& words) {
+        size_t num_set = 0;
+
+        for (auto word : words)
+        {
+            num_set += __builtin_popcountll(word);
+        }
+
+        return num_set;
+    };
+
+    SECTION("Frequencies Match p")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> bitmask((NUM_BITS + 63) / 64);
+
+        for (double p : {0.3, 0.001, 0.375, 0.75, 0.5, 0.999})
+        {
+            rng.bernoulli_fill(bitmask.data(), NUM_BITS, p);
+
+            const double expected = p * NUM_BITS;
+
+            REQUIRE(std::abs(count_bits(bitmask) - expected) < 4 * std::sqrt(expected * (1 - p)));
+        }
+    }
+
+    SECTION("Certain Outcomes Draw Nothing")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        std::vector<uint64_t> bitmask((NUM_BITS + 63) / 64);
+
+        rng.bernoulli_fill(bitmask.data(), NUM_BITS, 0.0);
+        REQUIRE(count_bits(bitmask) == 0);
+
+        rng.bernoulli_fill(bitmask.data(), NUM_BITS, 1.0);
+        REQUIRE(count_bits(bitmask) == NUM_BITS);
+
+        //  Below 2^-64 p has no binary digits within reach and is filled as zero, serial or SIMD
+
+        Xoshiro256PlusSerial serial_rng(SEED);
+
+        rng.bernoulli_fill(bitmask.data(), NUM_BITS, 1e-30);
+        REQUIRE(count_bits(bitmask) == 0);
+
+        serial_rng.bernoulli_fill(bitmask.data(), NUM_BITS, 1e-30);
+        REQUIRE(count_bits(bitmask) == 0);
+
+        REQUIRE(rng.next4()[0] == reference_rng.next4()[0]);
+    }
+
+    SECTION("One Half is the Raw Bits")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        std::vector<uint8_t> bitmask(128);
+        std::vector<uint8_t> reference_bytes(128);
+
+        rng.bernoulli_fill(bitmask.data(), 1000, 0.5);
+        reference_rng.fill_bytes(reference_bytes.data(), 125);
+
+        for (size_t i = 0; i < 125; i++)
+        {
+            REQUIRE(bitmask[i] == reference_bytes[i]);
+        }
+
+        //  The last three bits are in byte 125, the rest of it is cleared
+
+        bitmask[125] = 0xFF;
+
+        rng.bernoulli_fill(bitmask.data(), 1003, 0.5);
+        REQUIRE(bitmask[125] < 8);
+    }
+
+    SECTION("Serial, AVX2 and AVX512 Match")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        Xoshiro256PlusAVX512 avx512_rng(SEED);
+#endif
+
+        for (double p : {0.3, 0.5, 0.0625, 0.9})
+        {
+            for (size_t num_bits : {1, 255, 256, 1003, 4099})
+            {
+                std::vector<uint64_t> serial_words((num_bits + 63) / 64, ~UINT64_C(0));
+                std::vector<uint64_t> avx2_words((num_bits + 63) / 64);
+                std::vector<uint8_t> serial_bytes((num_bits + 7) / 8 + 1, 0xFF);
+                std::vector<uint8_t> avx2_bytes((num_bits + 7) / 8 + 1, 0xFF);
+
+                serial_rng.bernoulli_fill(serial_words.data(), num_bits, p);
+                avx2_rng.bernoulli_fill(avx2_words.data(), num_bits, p);
+
+                serial_rng.bernoulli_fill(serial_bytes.data(), num_bits, p);
+                avx2_rng.bernoulli_fill(avx2_bytes.data(), num_bits, p);
+
+#ifdef __AVX512_AVAILABLE__
+                std::vector<uint64_t> avx512_words((num_bits + 63) / 64);
+                std::vector<uint8_t> avx512_bytes((num_bits + 7) / 8 + 1, 0xFF);
+
+                avx512_rng.bernoulli_fill(avx512_words.data(), num_bits, p);
+                avx512_rng.bernoulli_fill(avx512_bytes.data(), num_bits, p);
+
+                REQUIRE(avx512_words == avx2_words);
+                REQUIRE(avx512_bytes == avx2_bytes);
+#endif
+
+                REQUIRE(serial_words == avx2_words);
+                REQUIRE(serial_bytes == avx2_bytes);
+
+                //  Bits past num_bits are cleared and the byte past the mask is untouched
+
+                if ((num_bits % 64) != 0)
+                {
+                    REQUIRE((serial_words.back() >> (num_bits % 64)) == 0);
+                }
+
+                REQUIRE(avx2_bytes.back() == 0xFF);
+            }
+        }
+
+        REQUIRE(serial_rng.next4()[3] == avx2_rng.next4()[3]);
+    }
+}
+
+TEST_CASE("Small Range Values", "[basic]")
+{
+    SECTION("next_small() Carves Each Draw")
+    {
+        Xoshiro256PlusSerial rng(SEED);
+        Xoshiro256PlusSerial reference_rng(SEED);
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            //  Eleven rolls of a die per draw, so 16 rolls take two draws
+
+            auto rolls = rng.next_small<16>(6);
+
+            uint64_t fraction = reference_rng.next();
+
+            for (auto j = 0; j < 16; j++)
+            {
+                if (j == 11)
+                {
+                    fraction = reference_rng.next();
+                }
+
+                const __uint128_t product = (__uint128_t)fraction * 6;
+
+                REQUIRE(rolls[j] == (uint32_t)(product >> 64));
+
+                fraction = (uint64_t)product;
+            }
+
+            //  Powers of two are the draw's bits from the top
+
+            auto nibbles = rng.next_small<16>(16);
+            auto draw = reference_rng.next();
+
+            for (auto j = 0; j < 16; j++)
+            {
+                REQUIRE(nibbles[j] == ((draw >> (60 - (4 * j))) & 0xF));
+            }
+
+            //  Large ranges take a draw per value
+
+            auto large = rng.next_small<2>(1000000);
+
+            REQUIRE(large[0] == reference_rng.next_64(0, 1000000));
+            REQUIRE(large[1] == reference_rng.next_64(0, 1000000));
+        }
+    }
+
+    SECTION("Frequencies")
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        SEFUtility::RNG::SmallRangeDraw die(6);
+
+        constexpr size_t NUM_ROLLS = 600000;
+
+        REQUIRE(die.values_per_draw() == 11);
+
+        size_t counts[6] = {0, 0, 0, 0, 0, 0};
+
+        for (size_t i = 0; i < NUM_ROLLS; i++)
+        {
+            const uint32_t roll = die(rng);
+
+            REQUIRE(roll < 6);
+
+            counts[roll]++;
+        }
+
+        for (auto count : counts)
+        {
+            REQUIRE(std::abs((double)count - (NUM_ROLLS / 6.0)) < 4 * std::sqrt(NUM_ROLLS * (1.0 / 6) * (5.0 / 6)));
+        }
+    }
+
+    SECTION("SmallRangeDraw Takes the Lanes in Turn")
+    {
+        Xoshiro256PlusSerial serial_rng(SEED);
+        Xoshiro256PlusAVX2 avx2_rng(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+
+        SEFUtility::RNG::SmallRangeDraw serial_draw(100);
+        SEFUtility::RNG::SmallRangeDraw avx2_draw(100);
+
+        const uint32_t values_per_draw = avx2_draw.values_per_draw();
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto draws = reference_rng.next4();
+
+            uint64_t fractions[4] = {draws[0], draws[1], draws[2], draws[3]};
+
+            for (uint32_t j = 0; j < 4 * values_per_draw; j++)
+            {
+                const __uint128_t product = (__uint128_t)fractions[j % 4] * 100;
+
+                fractions[j % 4] = (uint64_t)product;
+
+                REQUIRE(avx2_draw(avx2_rng) == (uint32_t)(product >> 64));
+                REQUIRE(serial_draw(serial_rng) == (uint32_t)(product >> 64));
+            }
+        }
+
+        //  reset() drops the rest of the step, so both calls refill
+
+        avx2_draw(avx2_rng);
+        avx2_draw.reset();
+        avx2_draw(avx2_rng);
+
+        reference_rng.next4();
+        reference_rng.next4();
+
+        REQUIRE(avx2_rng.next4()[0] == reference_rng.next4()[0]);
+    }
+}
+
+TEST_CASE("Standard Engine Adapter", "[basic]")
+{
+    typedef SEFUtility::RNG::Xoshiro256PlusEngine<SIMDInstructionSet::NONE> EngineSerial;
+    typedef SEFUtility::RNG::Xoshiro256PlusEngine<SIMDInstructionSet::AVX2> EngineAVX2;
+    typedef SEFUtility::RNG::Xoshiro256PlusEngine<SIMDInstructionSet::AVX2, 4> EngineAVX2SmallBlock;
+
+#ifdef __cpp_lib_concepts
+    static_assert(std::uniform_random_bit_generator<EngineAVX2>);
+#endif
+
+    SECTION("Values of next4()")
+    {
+        EngineSerial serial_engine(SEED);
+        EngineAVX2 avx2_engine(SEED);
+        EngineAVX2SmallBlock small_block_engine(SEED);
+        Xoshiro256PlusAVX2 reference_rng(SEED);
+#ifdef __AVX512_AVAILABLE__
+        SEFUtility::RNG::Xoshiro256PlusEngine<SIMDInstructionSet::AVX512> avx512_engine(SEED);
+#endif
+
+        for (auto i = 0; i < NUM_SAMPLES; i++)
+        {
+            auto reference_values = reference_rng.next4();
+
+            for (auto j = 0; j < 4; j++)
+            {
+                REQUIRE(serial_engine() == reference_values[j]);
+                REQUIRE(avx2_engine() == reference_values[j]);
+                REQUIRE(small_block_engine() == reference_values[j]);
+#ifdef __AVX512_AVAILABLE__
+                REQUIRE(avx512_engine() == reference_values[j]);
+#endif
+            }
+        }
+    }
+
+    SECTION("Discard, Seed and Equality")
+    {
+        for (unsigned long long distance : {0, 1, 3, 255, 256, 257, 1000, 100000})
+        {
+            EngineAVX2 engine(SEED);
+            EngineAVX2 stepped_engine(SEED);
+            EngineSerial serial_engine(SEED);
+            EngineSerial serial_stepped_engine(SEED);
+
+            //  Start part way into a block
+
+            engine();
+            stepped_engine();
+            serial_engine();
+            serial_stepped_engine();
+
+            engine.discard(distance);
+            serial_engine.discard(distance);
+
+            for (unsigned long long i = 0; i < distance; i++)
+            {
+                stepped_engine();
+                serial_stepped_engine();
+            }
+
+            REQUIRE(engine == stepped_engine);
+            REQUIRE(engine.position() == distance + 1);
+
+            for (auto i = 0; i < 300; i++)
+            {
+                const uint64_t value = engine();
+
+                REQUIRE(value == stepped_engine());
+                REQUIRE(serial_engine() == value);
+                REQUIRE(serial_stepped_engine() == value);
+            }
+        }
+
+        EngineAVX2 engine(SEED);
+        EngineAVX2 copied_engine(engine);
+        EngineAVX2 other_seed_engine(SEED + 1);
+
+        REQUIRE(engine == copied_engine);
+        REQUIRE(engine != other_seed_engine);
+
+        const uint64_t first_value = engine();
+
+        REQUIRE(engine != copied_engine);
+        REQUIRE(copied_engine() == first_value);
+        REQUIRE(engine == copied_engine);
+
+        EngineAVX2 block_copied_engine(engine);
+
+        REQUIRE(block_copied_engine() == engine());
+
+        other_seed_engine.seed(SEED);
+        engine.seed();
+
+        REQUIRE(other_seed_engine() == first_value);
+        REQUIRE(engine == EngineAVX2());
+    }
+
+    SECTION("Assignment and Stream Operators")
+    {
+        for (unsigned long long distance : {0, 1, 255, 256, 257, 100000})
+        {
+            EngineAVX2 engine(SEED + 1);
+
+            engine.discard(distance);
+
+            //  Assignment continues the same sequence
+
+            EngineAVX2 assigned_engine;
+
+            assigned_engine = engine;
+
+            REQUIRE(assigned_engine == engine);
+
+            //  Written and read back, by a default constructed engine and by one part way through another seed
+
+            std::stringstream state;
+
+            state << engine;
+
+            REQUIRE(state.str() == std::to_string(SEED + 1) + " " + std::to_string(distance));
+
+            EngineAVX2 restored_engine;
+            EngineSerial restored_serial_engine(SEED + 7);
+
+            restored_serial_engine();
+
+            std::stringstream(state.str()) >> restored_engine;
+            state >> restored_serial_engine;
+
+            REQUIRE(restored_engine == engine);
+
+            for (auto i = 0; i < 300; i++)
+            {
+                const uint64_t value = engine();
+
+                REQUIRE(assigned_engine() == value);
+                REQUIRE(restored_engine() == value);
+                REQUIRE(restored_serial_engine() == value);
+            }
+        }
+
+        //  A failed read leaves the engine alone
+
+        EngineAVX2 engine(SEED);
+        EngineAVX2 untouched_engine(SEED);
+
+        engine();
+        untouched_engine();
+
+        std::stringstream bad_state("not an engine");
+
+        bad_state >> engine;
+
+        REQUIRE(bad_state.fail());
+        REQUIRE(engine == untouched_engine);
+    }
+
+    SECTION("Standard Library Algorithms")
+    {
+        EngineAVX2 engine(SEED);
+
+        std::uniform_int_distribution<int> die(1, 6);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        size_t counts[6] = {0, 0, 0, 0, 0, 0};
+
+        for (auto i = 0; i < 60000; i++)
+        {
+            const int roll = die(engine);
+
+            REQUIRE(((roll >= 1) && (roll <= 6)));
+
+            counts[roll - 1]++;
+
+            const double value = unit(engine);
+
+            REQUIRE(((value >= 0.0) && (value < 1.0)));
+        }
+
+        for (auto count : counts)
+        {
+            REQUIRE(std::abs((double)count - 10000.0) < 4 * std::sqrt(60000 * (1.0 / 6) * (5.0 / 6)));
+        }
+
+        std::vector<int> values(1000);
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = i;
+        }
+
+        std::shuffle(values.begin(), values.end(), engine);
+
+        REQUIRE(!std::is_sorted(values.begin(), values.end()));
+
+        std::sort(values.begin(), values.end());
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            REQUIRE(values[i] == i);
+        }
+    }
+}
+
+TEST_CASE("Thread Local Generator Pool", "[basic]")
+{
+    typedef SEFUtility::RNG::Xoshiro256PlusPool<SIMDInstructionSet::NONE> PoolSerial;
+    typedef SEFUtility::RNG::Xoshiro256PlusPool<SIMDInstructionSet::AVX2> PoolAVX2;
+
+    constexpr size_t NUM_GENERATORS = 5;
+
+    SECTION("Generators are Jumped Streams")
+    {
+        PoolSerial serial_pool(SEED);
+        PoolAVX2 avx2_pool(SEED);
+
+        //  Requested out of order, the streams depend only on the index.
+
+        for (size_t i : {3, 0, 4, 1, 2})
+        {
+            Xoshiro256PlusAVX2 reference_rng(SEED);
+
+            reference_rng.jump_streams(i + 1);
+
+            auto& serial_rng = serial_pool.generator(i);
+            auto& avx2_rng = avx2_pool.generator(i);
+
+            for (auto j = 0; j < NUM_SAMPLES; j++)
+            {
+                const uint64_t reference_value = reference_rng.next();
+
+                REQUIRE(serial_rng.next() == reference_value);
+                REQUIRE(avx2_rng.next() == reference_value);
+
+                auto reference_values = reference_rng.next4();
+                auto serial_values = serial_rng.next4();
+                auto avx2_values = avx2_rng.next4();
+
+                for (auto k = 0; k < 4; k++)
+                {
+                    REQUIRE(serial_values[k] == reference_values[k]);
+                    REQUIRE(avx2_values[k] == reference_values[k]);
+                }
+            }
+        }
+
+        REQUIRE(avx2_pool.num_generators() == NUM_GENERATORS);
+    }
+
+    SECTION("Generators Do Not Share Cache Lines")
+    {
+        PoolAVX2 pool(SEED);
+
+        for (size_t i = 0; i < NUM_GENERATORS; i++)
+        {
+            const auto address = reinterpret_cast<uintptr_t>(&pool.generator(i));
+
+            REQUIRE(address % 64 == 0);
+
+            for (size_t j = 0; j < i; j++)
+            {
+                const auto other_address = reinterpret_cast<uintptr_t>(&pool.generator(j));
+
+                REQUIRE(std::max(address, other_address) - std::min(address, other_address) >=
+                        sizeof(Xoshiro256PlusAVX2));
+            }
+        }
+
+        //  Growing the pool leaves the earlier generators in place
+
+        auto* first_rng = &pool.generator(0);
+
+        pool.generator(100);
+
+        REQUIRE(&pool.generator(0) == first_rng);
+    }
+
+    SECTION("Local Generators")
+    {
+        PoolAVX2 pool(SEED);
+
+        auto& main_rng = pool.local();
+
+        REQUIRE(&pool.local() == &main_rng);
+        REQUIRE(&main_rng == &pool.generator(0));
+
+        //  A second pool of the same type does not see the first pool's cached generator
+
+        PoolAVX2 other_pool(SEED);
+
+        REQUIRE(&other_pool.local() == &other_pool.generator(0));
+        REQUIRE(&pool.local() == &main_rng);
+
+        std::vector<Xoshiro256PlusAVX2*> thread_rngs(NUM_GENERATORS - 1, nullptr);
+        std::vector<bool> stable(NUM_GENERATORS - 1, false);
+        std::vector<std::thread> threads;
+
+        for (size_t i = 0; i < thread_rngs.size(); i++)
+        {
+            threads.emplace_back([&pool, &thread_rngs, &stable, i] {
+                thread_rngs[i] = &pool.local();
+                stable[i] = (&pool.local() == thread_rngs[i]);
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < thread_rngs.size(); i++)
+        {
+            REQUIRE(stable[i]);
+            REQUIRE(thread_rngs[i] != &main_rng);
+
+            for (size_t j = 0; j < i; j++)
+            {
+                REQUIRE(thread_rngs[i] != thread_rngs[j]);
+            }
+        }
+
+        REQUIRE(pool.num_generators() == NUM_GENERATORS);
+    }
+
+    SECTION("Bound Threads are Deterministic")
+    {
+        PoolAVX2 pool(SEED);
+
+        std::vector<uint64_t> thread_values(NUM_GENERATORS, 0);
+        std::vector<bool> thread_bound(NUM_GENERATORS, false);
+        std::vector<std::thread> threads;
+
+        for (size_t i = 0; i < NUM_GENERATORS; i++)
+        {
+            threads.emplace_back([&pool, &thread_values, &thread_bound, i] {
+                thread_bound[i] = pool.bind(NUM_GENERATORS - 1 - i);
+                thread_values[i] = pool.local().next();
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < NUM_GENERATORS; i++)
+        {
+            Xoshiro256PlusAVX2 reference_rng(SEED);
+
+            reference_rng.jump_streams(NUM_GENERATORS - i);
+
+            REQUIRE(thread_bound[i]);
+            REQUIRE(thread_values[i] == reference_rng.next());
+        }
+    }
+
+    SECTION("An Index is Bound to One Thread")
+    {
+        PoolAVX2 pool(SEED);
+
+        //  Both threads stay alive until both have tried to bind, so neither can inherit the other's thread id.
+
+        std::atomic<size_t> num_attempts{0};
+        std::vector<bool> thread_bound(2, false);
+        std::vector<Xoshiro256PlusAVX2*> thread_rngs(2, nullptr);
+        std::vector<std::thread> threads;
+
+        for (size_t i = 0; i < 2; i++)
+        {
+            threads.emplace_back([&pool, &num_attempts, &thread_bound, &thread_rngs, i] {
+                thread_bound[i] = pool.bind(3);
+                thread_rngs[i] = &pool.local();
+
+                num_attempts++;
+
+                while (num_attempts < 2)
+                {
+                    std::this_thread::yield();
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(thread_bound[0] != thread_bound[1]);
+        REQUIRE(thread_rngs[0] != thread_rngs[1]);
+        REQUIRE(thread_rngs[thread_bound[0] ? 0 : 1] == &pool.generator(3));
+
+        //  Rebinding gives up the old index, which the next unbound thread takes
+
+        PoolAVX2 rebind_pool(SEED);
+
+        REQUIRE(&rebind_pool.local() == &rebind_pool.generator(0));
+        REQUIRE(rebind_pool.bind(0));
+        REQUIRE(rebind_pool.bind(2));
+        REQUIRE(&rebind_pool.local() == &rebind_pool.generator(2));
+
+        Xoshiro256PlusAVX2* other_rng = nullptr;
+        bool other_bound_to_two = true;
+
+        std::thread other_thread([&rebind_pool, &other_rng, &other_bound_to_two] {
+            other_bound_to_two = rebind_pool.bind(2);
+            other_rng = &rebind_pool.local();
+        });
+
+        other_thread.join();
+
+        REQUIRE(!other_bound_to_two);
+        REQUIRE(other_rng == &rebind_pool.generator(0));
+    }
+}
+
+TEST_CASE("Shared Stream", "[basic]")
+{
+    //  A small block size gives plenty of claims and jumps
+
+    constexpr size_t BLOCK_SIZE = 64;
+    constexpr size_t NUM_THREADS = 6;
+    constexpr size_t BLOCKS_PER_THREAD = 50;
+    constexpr size_t NUM_BLOCKS = NUM_THREADS * BLOCKS_PER_THREAD;
+
+    typedef SEFUtility::RNG::Xoshiro256PlusShared<SIMDInstructionSet::NONE, BLOCK_SIZE> SharedSerial;
+    typedef SEFUtility::RNG::Xoshiro256PlusShared<SIMDInstructionSet::AVX2, BLOCK_SIZE> SharedAVX2;
+
+    std::vector<uint64_t> stream_values(NUM_BLOCKS * BLOCK_SIZE);
+
+    Xoshiro256PlusAVX2(SEED).fill(stream_values.data(), stream_values.size());
+
+    SECTION("Blocks are Slices of the Stream")
+    {
+        SharedSerial serial_shared(SEED);
+        SharedAVX2 avx2_shared(SEED);
+#ifdef __AVX512_AVAILABLE__
+        SEFUtility::RNG::Xoshiro256PlusShared<SIMDInstructionSet::AVX512, BLOCK_SIZE> avx512_shared(SEED);
+#endif
+
+        std::vector<uint64_t> block(BLOCK_SIZE);
+
+        for (uint64_t i = 0; i < NUM_BLOCKS; i++)
+        {
+            REQUIRE(serial_shared.claim(block.data()) == i);
+            REQUIRE(std::equal(block.begin(), block.end(), stream_values.begin() + (i * BLOCK_SIZE)));
+
+            REQUIRE(avx2_shared.claim(block.data()) == i);
+            REQUIRE(std::equal(block.begin(), block.end(), stream_values.begin() + (i * BLOCK_SIZE)));
+
+#ifdef __AVX512_AVAILABLE__
+            REQUIRE(avx512_shared.claim(block.data()) == i);
+            REQUIRE(std::equal(block.begin(), block.end(), stream_values.begin() + (i * BLOCK_SIZE)));
+#endif
+        }
+
+        REQUIRE(avx2_shared.num_blocks_claimed() == NUM_BLOCKS);
+
+        for (uint64_t i : {NUM_BLOCKS - 1, uint64_t(0), uint64_t(17)})
+        {
+            avx2_shared.generate(i, block.data());
+
+            REQUIRE(std::equal(block.begin(), block.end(), stream_values.begin() + (i * BLOCK_SIZE)));
+        }
+    }
+
+    SECTION("Readers")
+    {
+        SharedAVX2 shared(SEED);
+        SharedAVX2::Reader reader(shared);
+        SharedAVX2::Reader other_reader(shared);
+
+        std::vector<uint64_t> block(BLOCK_SIZE);
+
+        //  The readers take turns at blocks 0 to 3 with a claim() by neither in between
+
+        REQUIRE(reader.next() == stream_values[0]);
+        REQUIRE(reader.block_index() == 0);
+        REQUIRE(other_reader.next() == stream_values[BLOCK_SIZE]);
+        REQUIRE(shared.claim(block.data()) == 2);
+        REQUIRE(reader.claim(block.data()) == 3);
+        REQUIRE(std::equal(block.begin(), block.end(), stream_values.begin() + (3 * BLOCK_SIZE)));
+
+        for (size_t i = 1; i < BLOCK_SIZE; i++)
+        {
+            REQUIRE(reader.next() == stream_values[i]);
+        }
+
+        REQUIRE(reader.next() == stream_values[4 * BLOCK_SIZE]);
+        REQUIRE(reader.block_index() == 4);
+    }
+
+    SECTION("Threads Draw Every Block Once")
+    {
+        SharedAVX2 shared(SEED);
+
+        std::vector<std::vector<uint64_t>> thread_blocks(NUM_THREADS);
+        std::vector<size_t> thread_mismatches(NUM_THREADS, 0);
+        std::vector<std::thread> threads;
+
+        for (size_t i = 0; i < NUM_THREADS; i++)
+        {
+            threads.emplace_back([&shared, &stream_values, &thread_blocks, &thread_mismatches, i] {
+                SharedAVX2::Reader reader(shared);
+
+                for (size_t j = 0; j < BLOCKS_PER_THREAD * BLOCK_SIZE; j++)
+                {
+                    const uint64_t value = reader.next();
+
+                    if ((j % BLOCK_SIZE) == 0)
+                    {
+                        thread_blocks[i].push_back(reader.block_index());
+                    }
+
+                    if (value != stream_values[(reader.block_index() * BLOCK_SIZE) + (j % BLOCK_SIZE)])
+                    {
+                        thread_mismatches[i]++;
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<uint64_t> claimed_blocks;
+
+        for (size_t i = 0; i < NUM_THREADS; i++)
+        {
+            REQUIRE(thread_mismatches[i] == 0);
+            REQUIRE(std::is_sorted(thread_blocks[i].begin(), thread_blocks[i].end()));
+
+            claimed_blocks.insert(claimed_blocks.end(), thread_blocks[i].begin(), thread_blocks[i].end());
+        }
+
+        std::sort(claimed_blocks.begin(), claimed_blocks.end());
+
+        REQUIRE(claimed_blocks.size() == NUM_BLOCKS);
+
+        for (size_t i = 0; i < NUM_BLOCKS; i++)
+        {
+            REQUIRE(claimed_blocks[i] == i);
+        }
+    }
+}
+
+TEST_CASE("Parallel Fills", "[basic]")
+{
+    using SEFUtility::RNG::parallel_fill;
+
+    //  An odd count leaves a partial last chunk and a partial last four wide step
+
+    constexpr size_t COUNT = 100003;
+
+    SECTION("Matches a Single Fill")
+    {
+        std::vector<uint64_t> expected(COUNT);
+
+        Xoshiro256PlusAVX2(SEED).fill(expected.data(), COUNT);
+
+        for (size_t chunk_size : {4, 64, 1000, 65536, 200000})
+        {
+            for (size_t num_threads : {1, 3, 8, 17})
+            {
+                std::vector<uint64_t> serial_values(COUNT, 0);
+                std::vector<uint64_t> avx2_values(COUNT, 0);
+
+                parallel_fill<SIMDInstructionSet::NONE>(SEED, serial_values.data(), COUNT, chunk_size, num_threads);
+                parallel_fill<SIMDInstructionSet::AVX2>(SEED, avx2_values.data(), COUNT, chunk_size, num_threads);
+
+                REQUIRE(serial_values == expected);
+                REQUIRE(avx2_values == expected);
+            }
+        }
+
+#ifdef __AVX512_AVAILABLE__
+        std::vector<uint64_t> avx512_values(COUNT, 0);
+
+        parallel_fill<SIMDInstructionSet::AVX512>(SEED, avx512_values.data(), COUNT, 1000, 5);
+
+        REQUIRE(avx512_values == expected);
+#endif
+
+        std::vector<uint64_t> default_values(COUNT, 0);
+
+        parallel_fill<SIMDInstructionSet::AVX2>(SEED, default_values.data(), COUNT);
+
+        REQUIRE(default_values == expected);
+
+        //  Nothing to fill
+
+        parallel_fill<SIMDInstructionSet::AVX2>(SEED, default_values.data(), 0, 64, 4);
+    }
+
+    SECTION("Doubles, uint32s and Floats")
+    {
+        std::vector<double> expected_doubles(COUNT);
+        std::vector<uint32_t> expected_uint32s(COUNT);
+        std::vector<float> expected_floats(COUNT);
+
+        Xoshiro256PlusAVX2(SEED).fill(expected_doubles.data(), COUNT);
+        Xoshiro256PlusAVX2(SEED).fill(expected_uint32s.data(), COUNT);
+        Xoshiro256PlusAVX2(SEED).fill(expected_floats.data(), COUNT);
+
+        for (size_t num_threads : {1, 6})
+        {
+            std::vector<double> doubles(COUNT, 0);
+            std::vector<uint32_t> uint32s(COUNT, 0);
+            std::vector<float> floats(COUNT, 0);
+
+            parallel_fill<SIMDInstructionSet::AVX2>(SEED, doubles.data(), COUNT, 1024, num_threads);
+            parallel_fill<SIMDInstructionSet::AVX2>(SEED, uint32s.data(), COUNT, 1024, num_threads);
+            parallel_fill<SIMDInstructionSet::AVX2>(SEED, floats.data(), COUNT, 1024, num_threads);
+
+            REQUIRE(doubles == expected_doubles);
+            REQUIRE(uint32s == expected_uint32s);
+            REQUIRE(floats == expected_floats);
+
+            parallel_fill<SIMDInstructionSet::NONE>(SEED, uint32s.data(), COUNT, 8, num_threads);
+
+            REQUIRE(uint32s == expected_uint32s);
+        }
+    }
+
+    SECTION("Reusing a Thread Pool")
+    {
+        std::vector<uint64_t> expected(COUNT);
+        std::vector<double> expected_doubles(COUNT);
+
+        Xoshiro256PlusAVX2(SEED).fill(expected.data(), COUNT);
+        Xoshiro256PlusAVX2(SEED).fill(expected_doubles.data(), COUNT);
+
+        for (size_t num_threads : {1, 4, 9})
+        {
+            SEFUtility::RNG::ParallelFill::ThreadPool pool(num_threads);
+
+            REQUIRE(pool.num_threads() == num_threads);
+
+            //  Fills of every size, one after another on the same workers, including fills with fewer chunks than
+            //      threads
+
+            for (size_t count : {COUNT, (size_t)0, (size_t)5, (size_t)1000, COUNT, (size_t)64 * 3})
+            {
+                std::vector<uint64_t> values(count, 0);
+                std::vector<double> doubles(count, 0);
+
+                parallel_fill<SIMDInstructionSet::AVX2>(pool, SEED, values.data(), count, 64);
+                parallel_fill<SIMDInstructionSet::NONE>(pool, SEED, doubles.data(), count, 1024);
+
+                REQUIRE(std::equal(values.begin(), values.end(), expected.begin()));
+                REQUIRE(std::equal(doubles.begin(), doubles.end(), expected_doubles.begin()));
+            }
+        }
+
+        //  Several threads sharing one pool take turns
+
+        SEFUtility::RNG::ParallelFill::ThreadPool pool(3);
+        std::vector<std::vector<uint64_t>> thread_values(4, std::vector<uint64_t>(COUNT, 0));
+        std::vector<std::thread> threads;
+
+        for (auto& values : thread_values)
+        {
+            threads.emplace_back(
+                [&pool, &values] { parallel_fill<SIMDInstructionSet::AVX2>(pool, SEED, values.data(), COUNT, 512); });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const auto& values : thread_values)
+        {
+            REQUIRE(values == expected);
+        }
+    }
+
+    SECTION("Chunks are Taken Once")
+    {
+        //  Many more threads than cores and tiny chunks, so most chunks are stolen
+
+        constexpr size_t NUM_CHUNKS = 5000;
+
+        SEFUtility::RNG::ParallelFill::ChunkRuns chunk_runs(NUM_CHUNKS, 16);
+
+        std::vector<std::vector<uint64_t>> thread_chunks(16);
+        std::vector<std::thread> threads;
+
+        for (size_t i = 0; i < thread_chunks.size(); i++)
+        {
+            threads.emplace_back([&chunk_runs, &thread_chunks, i] {
+                uint64_t chunk;
+
+                while (chunk_runs.next(i, chunk))
+                {
+                    thread_chunks[i].push_back(chunk);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<uint64_t> chunks;
+
+        for (const auto& taken : thread_chunks)
+        {
+            chunks.insert(chunks.end(), taken.begin(), taken.end());
+        }
+
+        std::sort(chunks.begin(), chunks.end());
+
+        REQUIRE(chunks.size() == NUM_CHUNKS);
+
+        for (size_t i = 0; i < NUM_CHUNKS; i++)
+        {
+            REQUIRE(chunks[i] == i);
+        }
+    }
+}
+
+TEST_CASE("Background Producer", "[basic]")
+{
+    constexpr size_t BLOCK_SIZE = 64;
+    constexpr size_t DEPTH = 4;
+    constexpr size_t NUM_BLOCKS = 100;
+
+    typedef SEFUtility::RNG::Xoshiro256PlusProducer<SIMDInstructionSet::NONE, uint64_t, BLOCK_SIZE> ProducerSerial;
+    typedef SEFUtility::RNG::Xoshiro256PlusProducer<SIMDInstructionSet::AVX2, uint64_t, BLOCK_SIZE> ProducerAVX2;
+    typedef SEFUtility::RNG::Xoshiro256PlusProducer<SIMDInstructionSet::AVX2, double, BLOCK_SIZE> DoubleProducerAVX2;
+
+    //  Waits for the producer to fill the ring, it then has no way to make progress until a block is returned.
+
+    auto wait_for_full_ring = [](const auto& producer) {
+        while ((producer.stats().blocks_produced < producer.depth()) || (producer.stats().producer_stalls == 0))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    SECTION("Blocks Follow the Stream")
+    {
+        std::vector<uint64_t> expected(NUM_BLOCKS * BLOCK_SIZE);
+        std::vector<double> expected_doubles(NUM_BLOCKS * BLOCK_SIZE);
+
+        Xoshiro256PlusAVX2(SEED).fill(expected.data(), expected.size());
+        Xoshiro256PlusAVX2(SEED).fill(expected_doubles.data(), expected_doubles.size());
+
+        ProducerSerial serial_producer(SEED, DEPTH);
+        ProducerAVX2 avx2_producer(SEED, DEPTH);
+        DoubleProducerAVX2 double_producer(SEED, DEPTH);
+
+        for (size_t i = 0; i < NUM_BLOCKS; i++)
+        {
+            const uint64_t* serial_block = serial_producer.pop();
+            const uint64_t* avx2_block = avx2_producer.pop();
+            const double* double_block = double_producer.pop();
+
+            REQUIRE(std::equal(serial_block, serial_block + BLOCK_SIZE, expected.begin() + (i * BLOCK_SIZE)));
+            REQUIRE(std::equal(avx2_block, avx2_block + BLOCK_SIZE, expected.begin() + (i * BLOCK_SIZE)));
+            REQUIRE(std::equal(double_block, double_block + BLOCK_SIZE, expected_doubles.begin() + (i * BLOCK_SIZE)));
+        }
+
+        REQUIRE(avx2_producer.stats().blocks_consumed == NUM_BLOCKS);
+    }
+
+    SECTION("Backpressure")
+    {
+        ProducerAVX2 producer(SEED, DEPTH);
+
+        wait_for_full_ring(producer);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        REQUIRE(producer.stats().blocks_produced == DEPTH);
+
+        //  The first block is held until the next pop, which returns it and wakes the producer
+
+        const uint64_t first_value = producer.pop()[0];
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        REQUIRE(producer.stats().blocks_produced == DEPTH);
+
+        REQUIRE(producer.pop() != nullptr);
+
+        while (producer.stats().blocks_produced == DEPTH)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        REQUIRE(producer.stats().blocks_produced == DEPTH + 1);
+        REQUIRE(first_value == Xoshiro256PlusAVX2(SEED).next4()[0]);
+    }
+
+    SECTION("Shutdown and Underruns")
+    {
+        ProducerAVX2 producer(SEED, DEPTH);
+
+        wait_for_full_ring(producer);
+
+        producer.stop();
+        producer.stop();
+
+        //  The blocks already in the ring are still handed out
+
+        size_t num_blocks = 0;
+
+        while (producer.pop() != nullptr)
+        {
+            num_blocks++;
+        }
+
+        REQUIRE(num_blocks == DEPTH);
+        REQUIRE(producer.try_pop() == nullptr);
+
+        const auto stats = producer.stats();
+
+        REQUIRE(stats.blocks_produced == DEPTH);
+        REQUIRE(stats.blocks_consumed == DEPTH);
+        REQUIRE(stats.underruns == 2);
+        REQUIRE(stats.producer_stalls == 1);
+
+        //  Destroyed with the producer asleep on a full ring
+
+        ProducerSerial sleeping_producer(SEED, DEPTH);
+
+        wait_for_full_ring(sleeping_producer);
+    }
+}
+
+//  The span overloads exist only in C++20 builds, the tests_cpp20 target builds these tests as C++20.  The test is
+//      keyed on the language version rather than __cpp_lib_span, so a C++20 build without the overloads fails to
+//      compile instead of skipping it.
+
+#if __cplusplus > 201703L
+TEST_CASE("Span Fills", "[basic]")
+{
+    constexpr size_t COUNT = 1001;
+
+    Xoshiro256PlusAVX2 span_rng(SEED);
+    Xoshiro256PlusAVX2 pointer_rng(SEED);
+
+    std::vector<uint64_t> span_values(COUNT);
+    std::vector<uint64_t> pointer_values(COUNT);
+
+    span_rng.fill(std::span<uint64_t>(span_values));
+    pointer_rng.fill(pointer_values.data(), COUNT);
+
+    REQUIRE(span_values == pointer_values);
+
+    std::vector<double> span_doubles(COUNT);
+    std::vector<double> pointer_doubles(COUNT);
+
+    span_rng.fill(std::span<double>(span_doubles));
+    pointer_rng.fill(pointer_doubles.data(), COUNT);
+
+    REQUIRE(span_doubles == pointer_doubles);
+
+    span_rng.fill(std::span<double>(span_doubles), -2.0, 3.0);
+    pointer_rng.fill(pointer_doubles.data(), COUNT, -2.0, 3.0);
+
+    REQUIRE(span_doubles == pointer_doubles);
+
+    for (auto value : span_doubles)
+    {
+        REQUIRE(((value >= -2.0) && (value < 3.0)));
+    }
+
+    std::vector<uint32_t> span_uint32s(COUNT);
+    std::vector<uint32_t> pointer_uint32s(COUNT);
+
+    span_rng.fill(std::span<uint32_t>(span_uint32s));
+    pointer_rng.fill(pointer_uint32s.data(), COUNT);
+
+    REQUIRE(span_uint32s == pointer_uint32s);
+
+    std::vector<float> span_floats(COUNT);
+    std::vector<float> pointer_floats(COUNT);
+
+    span_rng.fill(std::span<float>(span_floats));
+    pointer_rng.fill(pointer_floats.data(), COUNT);
+
+    REQUIRE(span_floats == pointer_floats);
+}
+#endif
@@ -1,17 +1,124 @@
 #include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "../include/SIMDInstructionSet.h"
 
 #include "../include/Xoshiro256Plus.h"
+#include "../include/Xoshiro256PlusBank.h"
+#include "../include/Xoshiro256PlusEngine.h"
+#include "../include/Xoshiro256PlusParallelFill.h"
+#include "../include/Xoshiro256PlusPool.h"
+#include "../include/Xoshiro256PlusProducer.h"
+#include "../include/Xoshiro256PlusShared.h"
+#include "../include/Xoshiro256PlusUniformInt.h"
 #include "Xoshiro256PlusReference.h"
 
 typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE> Xoshiro256PlusSerial;
 typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2> Xoshiro256PlusAVX2;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE, 8> Xoshiro256PlusSerialEightLanes;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2, 8> Xoshiro256PlusAVX2EightLanes;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2, 16> Xoshiro256PlusAVX2SixteenLanes;
+
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE, 4, SEFUtility::RNG::LaneInitialization::OnFirstUse>
+    Xoshiro256PlusSerialLazy;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX2, 4, SEFUtility::RNG::LaneInitialization::OnFirstUse>
+    Xoshiro256PlusAVX2Lazy;
+
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::NONE, 4,
+                                        SEFUtility::RNG::LaneInitialization::OnConstruction,
+                                        SEFUtility::RNG::StateLayout::ScalarOnly>
+    Xoshiro256PlusScalarOnly;
+
+typedef SEFUtility::RNG::Xoshiro256PlusBank<SIMDInstructionSet::NONE> Xoshiro256PlusBankSerial;
+typedef SEFUtility::RNG::Xoshiro256PlusBank<SIMDInstructionSet::AVX2> Xoshiro256PlusBankAVX2;
+
+typedef SEFUtility::RNG::Xoshiro256PlusEngine<SIMDInstructionSet::NONE> Xoshiro256PlusEngineSerial;
+typedef SEFUtility::RNG::Xoshiro256PlusEngine<SIMDInstructionSet::AVX2> Xoshiro256PlusEngineAVX2;
+typedef SEFUtility::RNG::Xoshiro256PlusEngine<SIMDInstructionSet::AVX2, 4096> Xoshiro256PlusEngineAVX2LargeBlock;
+
+typedef SEFUtility::RNG::Xoshiro256PlusPool<SIMDInstructionSet::AVX2> Xoshiro256PlusPoolAVX2;
+typedef SEFUtility::RNG::Xoshiro256PlusShared<SIMDInstructionSet::AVX2> Xoshiro256PlusSharedAVX2;
+typedef SEFUtility::RNG::Xoshiro256PlusProducer<SIMDInstructionSet::AVX2> Xoshiro256PlusProducerAVX2;
+typedef SEFUtility::RNG::Xoshiro256PlusProducer<SIMDInstructionSet::AVX2, double> Xoshiro256PlusDoubleProducerAVX2;
+
+#ifdef __AVX512_AVAILABLE__
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX512> Xoshiro256PlusAVX512;
+typedef SEFUtility::RNG::Xoshiro256PlusBank<SIMDInstructionSet::AVX512> Xoshiro256PlusBankAVX512;
+typedef SEFUtility::RNG::Xoshiro256Plus<SIMDInstructionSet::AVX512, 16> Xoshiro256PlusAVX512SixteenLanes;
+#endif
 
 constexpr size_t NUM_ITERATIONS = 1000000;
 constexpr uint64_t SEED = 1;
 
+//  The bulk fill benchmarks write NUM_ITERATIONS values, i.e. 8MB, so the throughput in GB/s is 0.008 divided by the
+//      mean time in seconds.
+
+constexpr size_t FILL_BUFFER_BYTES = NUM_ITERATIONS * sizeof(uint64_t);
+
+//  The bank benchmarks step 4096 streams enough times to draw roughly NUM_ITERATIONS values, the single RNGs benchmark
+//      holds the same streams as an array of separate generators.
+
+constexpr size_t BANK_STREAMS = 4096;
+constexpr size_t BANK_STEPS = NUM_ITERATIONS / BANK_STREAMS;
+
+//  The thread scaling benchmarks split NUM_ITERATIONS values across the threads, so with enough cores the time should
+//      fall in proportion to the thread count.  Thread start up is included in the time.
+
+constexpr size_t SCALING_THREAD_COUNTS[] = {1, 2, 4, 8};
+constexpr size_t CONTENTION_THREAD_COUNTS[] = {1, 4, 16, 64};
+
+//  The parallel fills write 64MB, well past the caches, so with enough cores they run into the memory bandwidth.
+
+constexpr size_t PARALLEL_FILL_COUNT = 8 * NUM_ITERATIONS;
+
+//  The small and medium fills, 128KB and 2MB, are split into one chunk per thread of a four thread pool.
+
+constexpr size_t SMALL_PARALLEL_FILL_COUNT = 16 * 1024;
+constexpr size_t MEDIUM_PARALLEL_FILL_COUNT = 256 * 1024;
+constexpr size_t PARALLEL_FILL_POOL_THREADS = 4;
+
+template <typename F>
+void run_threads(size_t num_threads, F&& thread_function)
+{
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        threads.emplace_back(thread_function, i);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+//  Minimal uniform random bit generator over next(), so the std distributions can be driven by the same generator.
+
+class NextURBG
+{
+   public:
+    typedef uint64_t result_type;
+
+    explicit NextURBG(uint64_t seed) : rng_(seed) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()() { return rng_.next(); }
+
+   private:
+    Xoshiro256PlusSerial rng_;
+};
+
 
 
 TEST_CASE("Benchmarks", "[basic]")
@@ -69,6 +176,209 @@ TEST_CASE("Benchmarks", "[basic]")
         REQUIRE( sum > 0 );
     };
 
+    BENCHMARK_ADVANCED("Serial next() unbiased Bounded")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.next_unbiased( 300, 900 );
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    //  A range of 3 * 2^30 rejects a quarter of the draws, the worst case for the unbiased bounding
+
+    BENCHMARK_ADVANCED("Serial next() unbiased Bounded large range")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.next_unbiased( 0, 3221225472 );
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial next() 64 bit Bounded")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.next_64( 300, 0x1234567890 );
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    //  Compile time bounds and UniformInt against the runtime bounded next() for a die and a power of two range
+
+    BENCHMARK_ADVANCED("Serial next() die runtime Bounded")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.next( 1, 7 );
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial next<1,7>() die compile time Bounded")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.next<1, 7>();
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial UniformInt<1,7> die")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+        SEFUtility::RNG::UniformInt<1, 7>    distribution;
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum,&distribution] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += distribution( rng );
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial next_small<8>() die")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 8)
+            {
+                for (auto roll : rng.next_small<8>( 6 ))
+                {
+                    sum += roll + 1;
+                }
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial SmallRangeDraw die")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+        SEFUtility::RNG::SmallRangeDraw    die( 6 );
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum,&die] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += die( rng ) + 1;
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX SmallRangeDraw die")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        SEFUtility::RNG::SmallRangeDraw    die( 6 );
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum,&die] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += die( rng ) + 1;
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial next() runtime Bounded power of two")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.next( 0, 256 );
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial next<0,256>() compile time Bounded")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.next<0, 256>();
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial UniformInt<0,256>")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+        SEFUtility::RNG::UniformInt<0, 256>    distribution;
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum,&distribution] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += distribution( rng );
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
     BENCHMARK_ADVANCED("Serial dnext()")(Catch::Benchmark::Chronometer meter)
     {
         Xoshiro256PlusSerial rng(SEED);
@@ -161,6 +471,22 @@ TEST_CASE("Benchmarks", "[basic]")
         
         REQUIRE( sum[0] != 0 );
     };
+
+    BENCHMARK_ADVANCED("Serial next4() unbiased bounded sum in __m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        __m256i  sum = _mm256_set1_epi64x( 0 );
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_epi64( sum, rng.next4_unbiased(300, 400) );
+            }
+        });
+
+        REQUIRE( sum[0] != 0 );
+    };
 #endif
 
     BENCHMARK_ADVANCED("Serial next4() bounded sum in uint64_t")(Catch::Benchmark::Chronometer meter)
@@ -262,6 +588,38 @@ TEST_CASE("Benchmarks", "[basic]")
         REQUIRE( sum != 0.0 );
     };
 
+    BENCHMARK_ADVANCED("Serial next4() loop into 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusSerial::FourIntegerValues next_values(rng.next4());
+
+                buffer[i] = next_values[0];
+                buffer[i + 1] = next_values[1];
+                buffer[i + 2] = next_values[2];
+                buffer[i + 3] = next_values[3];
+            }
+        });
+
+        REQUIRE(buffer[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("Serial fill() 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer[0] != 0);
+    };
+
 #ifdef __AVX2_AVAILABLE__
     BENCHMARK_ADVANCED("AVX next4() no sum")(Catch::Benchmark::Chronometer meter)
     {
@@ -328,65 +686,220 @@ TEST_CASE("Benchmarks", "[basic]")
         REQUIRE( sum[0] != 0 );
     };
 
-    BENCHMARK_ADVANCED("AVX next4() bounded sum in uint64_t")(Catch::Benchmark::Chronometer meter)
+    BENCHMARK_ADVANCED("AVX next4() unbiased bounded sum in _m256i")(Catch::Benchmark::Chronometer meter)
     {
         Xoshiro256PlusAVX2 rng(SEED);
 
-        alignas(32) uint64_t  sum = 0;
+        __m256i  sum = _mm256_set1_epi64x( 0 );
 
         meter.measure([&rng,&sum] {
             for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
             {
-                auto    next_values( rng.next4( 200, 700 ) );
-
-                sum += next_values[0];
-                sum += next_values[1];
-                sum += next_values[2];
-                sum += next_values[3];
+                sum = _mm256_add_epi64( sum, rng.next4_unbiased( 300, 600 ) );
             }
         });
-        
-        REQUIRE( sum > 0 );
+
+        REQUIRE( sum[0] != 0 );
     };
 
-    BENCHMARK_ADVANCED("AVX dnext4() sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    BENCHMARK_ADVANCED("AVX next4() unbiased bounded large range sum in _m256i")(Catch::Benchmark::Chronometer meter)
     {
         Xoshiro256PlusAVX2 rng(SEED);
 
-        __m256d  sum = _mm256_set1_pd( 0.0 );
+        __m256i  sum = _mm256_set1_epi64x( 0 );
 
         meter.measure([&rng,&sum] {
             for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
             {
-                sum = _mm256_add_pd( sum, rng.dnext4() );
+                sum = _mm256_add_epi64( sum, rng.next4_unbiased( 0, 3221225472 ) );
             }
         });
-        
-        REQUIRE( sum[0] != 0.0 );
+
+        REQUIRE( sum[0] != 0 );
     };
 
-    BENCHMARK_ADVANCED("AVX dnext4() sum in double")(Catch::Benchmark::Chronometer meter)
+    BENCHMARK_ADVANCED("AVX next4_64() bounded sum in _m256i")(Catch::Benchmark::Chronometer meter)
     {
         Xoshiro256PlusAVX2 rng(SEED);
 
-        alignas(32) double  sum = 0;
+        __m256i  sum = _mm256_set1_epi64x( 0 );
 
         meter.measure([&rng,&sum] {
             for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
             {
-                Xoshiro256PlusAVX2::FourDoubleValues next_values( rng.dnext4() );
-
-                sum += next_values[0];
-                sum += next_values[1];
-                sum += next_values[2];
-                sum += next_values[3];
+                sum = _mm256_add_epi64( sum, rng.next4_64( 300, 0x1234567890 ) );
             }
         });
-        
-        REQUIRE( sum != 0.0 );
+
+        REQUIRE( sum[0] != 0 );
     };
 
-    BENCHMARK_ADVANCED("AVX dnext4() bounded sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    //  Fisher-Yates style per lane bounds against the scalar fallback of four bounded next() calls
+
+    BENCHMARK_ADVANCED("AVX next4() per lane bounded sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256i  sum = _mm256_set1_epi64x( 0 );
+
+        meter.measure([&rng,&sum] {
+            __m256i  upper_bounds = _mm256_set_epi64x( 4, 3, 2, 1 );
+
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_epi64( sum, rng.next4( _mm256_setzero_si256(), upper_bounds ) );
+                upper_bounds = _mm256_add_epi64( upper_bounds, _mm256_set1_epi64x( 4 ) );
+            }
+        });
+
+        REQUIRE( sum[0] != 0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX next4_unbiased() per lane bounded sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256i  sum = _mm256_set1_epi64x( 0 );
+
+        meter.measure([&rng,&sum] {
+            __m256i  upper_bounds = _mm256_set_epi64x( 4, 3, 2, 1 );
+
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_epi64( sum, rng.next4_unbiased( _mm256_setzero_si256(), upper_bounds ) );
+                upper_bounds = _mm256_add_epi64( upper_bounds, _mm256_set1_epi64x( 4 ) );
+            }
+        });
+
+        REQUIRE( sum[0] != 0 );
+    };
+
+    BENCHMARK_ADVANCED("Serial next() four per lane bounds sum in uint64_t")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        uint64_t    sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (uint32_t i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                sum += rng.next( 0, i + 1 );
+                sum += rng.next( 0, i + 2 );
+                sum += rng.next( 0, i + 3 );
+                sum += rng.next( 0, i + 4 );
+            }
+        });
+
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX next4<300,600>() compile time bounded sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256i  sum = _mm256_set1_epi64x( 0 );
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_epi64( sum, rng.next4<300, 600>() );
+            }
+        });
+
+        REQUIRE( sum[0] != 0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX next4<0,256>() compile time bounded sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256i  sum = _mm256_set1_epi64x( 0 );
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_epi64( sum, rng.next4<0, 256>() );
+            }
+        });
+
+        REQUIRE( sum[0] != 0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX next4_unbiased<300,600>() compile time bounded sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256i  sum = _mm256_set1_epi64x( 0 );
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_epi64( sum, rng.next4_unbiased<300, 600>() );
+            }
+        });
+
+        REQUIRE( sum[0] != 0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX next4() bounded sum in uint64_t")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        alignas(32) uint64_t  sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                auto    next_values( rng.next4( 200, 700 ) );
+
+                sum += next_values[0];
+                sum += next_values[1];
+                sum += next_values[2];
+                sum += next_values[3];
+            }
+        });
+        
+        REQUIRE( sum > 0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4() sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256d  sum = _mm256_set1_pd( 0.0 );
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_pd( sum, rng.dnext4() );
+            }
+        });
+        
+        REQUIRE( sum[0] != 0.0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4() sum in double")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        alignas(32) double  sum = 0;
+
+        meter.measure([&rng,&sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                Xoshiro256PlusAVX2::FourDoubleValues next_values( rng.dnext4() );
+
+                sum += next_values[0];
+                sum += next_values[1];
+                sum += next_values[2];
+                sum += next_values[3];
+            }
+        });
+        
+        REQUIRE( sum != 0.0 );
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4() bounded sum in __m256d")(Catch::Benchmark::Chronometer meter)
     {
         Xoshiro256PlusAVX2 rng(SEED);
 
@@ -423,5 +936,1905 @@ TEST_CASE("Benchmarks", "[basic]")
         REQUIRE( sum != 0.0 );
     };
 
+
+    BENCHMARK_ADVANCED("Serial next8() sum in uint64_t")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerialEightLanes rng(SEED);
+
+        uint64_t sum = 0;
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 8; i++)
+            {
+                auto next_values(rng.next8());
+
+                for (auto j = 0; j < 8; j++)
+                {
+                    sum += next_values[j];
+                }
+            }
+        });
+
+        REQUIRE(sum > 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX next8() sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2EightLanes rng(SEED);
+
+        __m256i sum = _mm256_set1_epi64x(0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 8; i++)
+            {
+                auto next_values(rng.next8());
+
+                sum = _mm256_add_epi64(sum, _mm256_add_epi64(next_values.packed4(0), next_values.packed4(1)));
+            }
+        });
+
+        REQUIRE(sum[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX next16() sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2SixteenLanes rng(SEED);
+
+        __m256i sum = _mm256_set1_epi64x(0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 16; i++)
+            {
+                auto next_values(rng.next16());
+
+                __m256i lower_sum = _mm256_add_epi64(next_values.packed4(0), next_values.packed4(1));
+                __m256i upper_sum = _mm256_add_epi64(next_values.packed4(2), next_values.packed4(3));
+
+                sum = _mm256_add_epi64(sum, _mm256_add_epi64(lower_sum, upper_sum));
+            }
+        });
+
+        REQUIRE(sum[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext8() sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2EightLanes rng(SEED);
+
+        __m256d sum = _mm256_set1_pd(0.0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 8; i++)
+            {
+                auto next_values(rng.dnext8());
+
+                sum = _mm256_add_pd(sum, _mm256_add_pd(next_values.packed4(0), next_values.packed4(1)));
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext16() sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2SixteenLanes rng(SEED);
+
+        __m256d sum = _mm256_set1_pd(0.0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 16; i++)
+            {
+                auto next_values(rng.dnext16());
+
+                __m256d lower_sum = _mm256_add_pd(next_values.packed4(0), next_values.packed4(1));
+                __m256d upper_sum = _mm256_add_pd(next_values.packed4(2), next_values.packed4(3));
+
+                sum = _mm256_add_pd(sum, _mm256_add_pd(lower_sum, upper_sum));
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0);
+    };
+
+#ifdef __AVX512_AVAILABLE__
+    BENCHMARK_ADVANCED("AVX512 next4() sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX512 rng(SEED);
+
+        __m256i sum = _mm256_set1_epi64x(0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_epi64(sum, rng.next4());
+            }
+        });
+
+        REQUIRE(sum[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX512 next8() no sum")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX512 rng(SEED);
+
+        meter.measure([&rng] {
+            for (auto i = 0; i < NUM_ITERATIONS / 8; i++)
+            {
+                rng.next8();
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX512 next8() sum in _m512i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX512 rng(SEED);
+
+        __m512i sum = _mm512_set1_epi64(0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 8; i++)
+            {
+                sum = _mm512_add_epi64(sum, rng.next8());
+            }
+        });
+
+        REQUIRE(sum[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX512 next8() bounded sum in _m512i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX512 rng(SEED);
+
+        __m512i sum = _mm512_set1_epi64(0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 8; i++)
+            {
+                sum = _mm512_add_epi64(sum, rng.next8(300, 600));
+            }
+        });
+
+        REQUIRE(sum[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX512 next16() sum in _m512i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX512SixteenLanes rng(SEED);
+
+        __m512i sum = _mm512_set1_epi64(0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 16; i++)
+            {
+                auto next_values(rng.next16());
+
+                sum = _mm512_add_epi64(sum, _mm512_add_epi64(next_values.packed8(0), next_values.packed8(1)));
+            }
+        });
+
+        REQUIRE(sum[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX512 dnext8() sum in __m512d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX512 rng(SEED);
+
+        __m512d sum = _mm512_set1_pd(0.0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 8; i++)
+            {
+                sum = _mm512_add_pd(sum, rng.dnext8());
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX512 dnext8() bounded sum in __m512d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX512 rng(SEED);
+
+        __m512d sum = _mm512_set1_pd(0.0);
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS / 8; i++)
+            {
+                sum = _mm512_add_pd(sum, rng.dnext8(-100, 100));
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0);
+    };
+#endif
+
+    BENCHMARK_ADVANCED("AVX next4() loop into 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusAVX2::FourIntegerValues next_values(rng.next4());
+
+                buffer[i] = next_values[0];
+                buffer[i + 1] = next_values[1];
+                buffer[i + 2] = next_values[2];
+                buffer[i + 3] = next_values[3];
+            }
+        });
+
+        REQUIRE(buffer[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill() 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_bytes() 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint8_t> buffer(FILL_BUFFER_BYTES + 1);
+
+        meter.measure([&rng, &buffer] { rng.fill_bytes(buffer.data() + 1, FILL_BUFFER_BYTES); });
+
+        REQUIRE(buffer[1] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4() bounded loop into 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusAVX2::FourDoubleValues next_values(rng.dnext4(-100, 100));
+
+                buffer[i] = next_values[0];
+                buffer[i + 1] = next_values[1];
+                buffer[i + 2] = next_values[2];
+                buffer[i + 3] = next_values[3];
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill() bounded doubles 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size(), -100, 100); });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    //  Unit interval conversions against the default 52 bit mantissa conversion of dnext4() and fill() above.
+
+    BENCHMARK_ADVANCED("AVX fill() doubles 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("Serial dnext<ClosedOpen53>()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        double sum = 0;
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.dnext<SEFUtility::RNG::UnitInterval::ClosedOpen53>();
+            }
+        });
+
+        REQUIRE(sum != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4<ClosedOpen53>() sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256d sum = _mm256_setzero_pd();
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                sum = _mm256_add_pd(sum, rng.dnext4<SEFUtility::RNG::UnitInterval::ClosedOpen53>());
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill<ClosedOpen53>() doubles 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            rng.fill<SEFUtility::RNG::UnitInterval::ClosedOpen53>(buffer.data(), buffer.size());
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("Serial dnext<Open>()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        double sum = 0;
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.dnext<SEFUtility::RNG::UnitInterval::Open>();
+            }
+        });
+
+        REQUIRE(sum != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4<Open>() sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256d sum = _mm256_setzero_pd();
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                sum = _mm256_add_pd(sum, rng.dnext4<SEFUtility::RNG::UnitInterval::Open>());
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill<Open>() doubles 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            rng.fill<SEFUtility::RNG::UnitInterval::Open>(buffer.data(), buffer.size());
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("Serial dnext<Closed>()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        double sum = 0;
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.dnext<SEFUtility::RNG::UnitInterval::Closed>();
+            }
+        });
+
+        REQUIRE(sum != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4<Closed>() sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256d sum = _mm256_setzero_pd();
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                sum = _mm256_add_pd(sum, rng.dnext4<SEFUtility::RNG::UnitInterval::Closed>());
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill<Closed>() doubles 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            rng.fill<SEFUtility::RNG::UnitInterval::Closed>(buffer.data(), buffer.size());
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("Serial dnext<Dense>()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        double sum = 0;
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += rng.dnext<SEFUtility::RNG::UnitInterval::Dense>();
+            }
+        });
+
+        REQUIRE(sum != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4<Dense>() sum in __m256d")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256d sum = _mm256_setzero_pd();
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                sum = _mm256_add_pd(sum, rng.dnext4<SEFUtility::RNG::UnitInterval::Dense>());
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill<Dense>() doubles 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            rng.fill<SEFUtility::RNG::UnitInterval::Dense>(buffer.data(), buffer.size());
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    //  Bernoulli bitmasks of 1M bits, the throughput in bits per second is 1M over the mean time.  The baseline
+    //      compares dnext4() with p, a 64 bit draw per bit.
+
+    BENCHMARK_ADVANCED("AVX dnext4() compare p 0.3 1M bits")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint8_t> bitmask(NUM_ITERATIONS / 8);
+
+        meter.measure([&rng, &bitmask] {
+            const __m256d p = _mm256_set1_pd(0.3);
+
+            for (size_t i = 0; i < bitmask.size(); i++)
+            {
+                const int low_bits = _mm256_movemask_pd(_mm256_cmp_pd(rng.dnext4(), p, _CMP_LT_OQ));
+                const int high_bits = _mm256_movemask_pd(_mm256_cmp_pd(rng.dnext4(), p, _CMP_LT_OQ));
+
+                bitmask[i] = (uint8_t)(low_bits | (high_bits << 4));
+            }
+        });
+
+        REQUIRE(bitmask.size() == NUM_ITERATIONS / 8);
+    };
+
+    BENCHMARK_ADVANCED("Serial bernoulli_fill() p 0.3 1M bits")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<uint64_t> bitmask(NUM_ITERATIONS / 64);
+
+        meter.measure([&rng, &bitmask] { rng.bernoulli_fill(bitmask.data(), NUM_ITERATIONS, 0.3); });
+
+        REQUIRE(bitmask[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX bernoulli_fill() p 0.3 1M bits")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> bitmask(NUM_ITERATIONS / 64);
+
+        meter.measure([&rng, &bitmask] { rng.bernoulli_fill(bitmask.data(), NUM_ITERATIONS, 0.3); });
+
+        REQUIRE(bitmask[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX bernoulli_fill() p 0.25 1M bits")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> bitmask(NUM_ITERATIONS / 64);
+
+        meter.measure([&rng, &bitmask] { rng.bernoulli_fill(bitmask.data(), NUM_ITERATIONS, 0.25); });
+
+        REQUIRE(bitmask[0] != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX bernoulli_fill() p 0.5 1M bits")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> bitmask(NUM_ITERATIONS / 64);
+
+        meter.measure([&rng, &bitmask] { rng.bernoulli_fill(bitmask.data(), NUM_ITERATIONS, 0.5); });
+
+        REQUIRE(bitmask[0] != 0);
+    };
+
+    //  uint32s and floats, eight per four wide step.  The fills write 8MB as well, twice as many values.
+
+    BENCHMARK_ADVANCED("AVX next8_u32() sum in __m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256i sum = _mm256_setzero_si256();
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 8)
+            {
+                sum = _mm256_add_epi32(sum, rng.next8_u32());
+            }
+        });
+
+        REQUIRE(_mm256_testz_si256(sum, sum) == 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX next8_u32() bounded sum in __m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256i sum = _mm256_setzero_si256();
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 8)
+            {
+                sum = _mm256_add_epi32(sum, rng.next8_u32(300, 900));
+            }
+        });
+
+        REQUIRE(_mm256_testz_si256(sum, sum) == 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fnext8() sum in __m256")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        __m256 sum = _mm256_setzero_ps();
+
+        meter.measure([&rng, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 8)
+            {
+                sum = _mm256_add_ps(sum, rng.fnext8());
+            }
+        });
+
+        REQUIRE(sum[0] != 0.0f);
+    };
+
+    BENCHMARK_ADVANCED("Serial fill() uint32s 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<uint32_t> buffer(NUM_ITERATIONS * 2);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS * 2);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill() uint32s 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint32_t> buffer(NUM_ITERATIONS * 2);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS * 2);
+    };
+
+    BENCHMARK_ADVANCED("Serial fill() floats 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<float> buffer(NUM_ITERATIONS * 2);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS * 2);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill() floats 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<float> buffer(NUM_ITERATIONS * 2);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS * 2);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill() bounded floats 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<float> buffer(NUM_ITERATIONS * 2);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size(), -100.0f, 100.0f); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS * 2);
+    };
+
+    //  Normal doubles, NUM_ITERATIONS values each.  std::normal_distribution with std::mt19937_64 and a Box-Muller
+    //      transform of dnext4() pairs are the baselines.
+
+    BENCHMARK_ADVANCED("std::normal_distribution with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 rng(SEED);
+        std::normal_distribution<double> distribution(0.0, 1.0);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4() Box-Muller")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusAVX2::FourDoubleValues uniforms(rng.dnext4());
+
+                const double radius1 = std::sqrt(-2.0 * std::log(1.0 - uniforms[0]));
+                const double radius2 = std::sqrt(-2.0 * std::log(1.0 - uniforms[2]));
+
+                buffer[i] = radius1 * std::cos(2.0 * M_PI * uniforms[1]);
+                buffer[i + 1] = radius1 * std::sin(2.0 * M_PI * uniforms[1]);
+                buffer[i + 2] = radius2 * std::cos(2.0 * M_PI * uniforms[3]);
+                buffer[i + 3] = radius2 * std::sin(2.0 * M_PI * uniforms[3]);
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("Serial normal()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = rng.normal();
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("Serial normal4()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusSerial::FourDoubleValues next_values(rng.normal4());
+
+                buffer[i] = next_values[0];
+                buffer[i + 1] = next_values[1];
+                buffer[i + 2] = next_values[2];
+                buffer[i + 3] = next_values[3];
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX normal4()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusAVX2::FourDoubleValues next_values(rng.normal4());
+
+                buffer[i] = next_values[0];
+                buffer[i + 1] = next_values[1];
+                buffer[i + 2] = next_values[2];
+                buffer[i + 3] = next_values[3];
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_normal() 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_normal(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    //  Exponential and geometric values, NUM_ITERATIONS each, against the standard library distributions and
+    //      std::log applied to dnext4()
+
+    BENCHMARK_ADVANCED("std::exponential_distribution with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 rng(SEED);
+        std::exponential_distribution<double> distribution(2.0);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX dnext4() with std::log")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusAVX2::FourDoubleValues uniforms(rng.dnext4());
+
+                buffer[i] = -std::log(1.0 - uniforms[0]) * 0.5;
+                buffer[i + 1] = -std::log(1.0 - uniforms[1]) * 0.5;
+                buffer[i + 2] = -std::log(1.0 - uniforms[2]) * 0.5;
+                buffer[i + 3] = -std::log(1.0 - uniforms[3]) * 0.5;
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("Serial exponential4()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusSerial::FourDoubleValues next_values(rng.exponential4(2.0));
+
+                buffer[i] = next_values[0];
+                buffer[i + 1] = next_values[1];
+                buffer[i + 2] = next_values[2];
+                buffer[i + 3] = next_values[3];
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX exponential4()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusAVX2::FourDoubleValues next_values(rng.exponential4(2.0));
+
+                buffer[i] = next_values[0];
+                buffer[i + 1] = next_values[1];
+                buffer[i + 2] = next_values[2];
+                buffer[i + 3] = next_values[3];
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_exponential() 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_exponential(buffer.data(), buffer.size(), 2.0); });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("std::geometric_distribution with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 rng(SEED);
+        std::geometric_distribution<uint64_t> distribution(0.1);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_geometric() 8MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_geometric(buffer.data(), buffer.size(), 0.1); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    //  Poisson and binomial counts, NUM_ITERATIONS each, for a mean drawn by inversion and one drawn by transformed
+    //      rejection.
+
+    BENCHMARK_ADVANCED("std::poisson_distribution mean 4 with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 rng(SEED);
+        std::poisson_distribution<uint64_t> distribution(4.0);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("Serial fill_poisson() mean 4")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_poisson(buffer.data(), buffer.size(), 4.0); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_poisson() mean 4")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_poisson(buffer.data(), buffer.size(), 4.0); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("std::poisson_distribution mean 100 with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 rng(SEED);
+        std::poisson_distribution<uint64_t> distribution(100.0);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("Serial fill_poisson() mean 100")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_poisson(buffer.data(), buffer.size(), 100.0); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_poisson() mean 100")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_poisson(buffer.data(), buffer.size(), 100.0); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("std::binomial_distribution n 100 p 0.05 with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 rng(SEED);
+        std::binomial_distribution<uint64_t> distribution(100, 0.05);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_binomial() n 100 p 0.05")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_binomial(buffer.data(), buffer.size(), 100, 0.05); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("std::binomial_distribution n 1000 p 0.3 with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 rng(SEED);
+        std::binomial_distribution<uint64_t> distribution(1000, 0.3);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_binomial() n 1000 p 0.3")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<uint64_t> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_binomial(buffer.data(), buffer.size(), 1000, 0.3); });
+
+        REQUIRE(buffer.size() == NUM_ITERATIONS);
+    };
+
+    //  Gamma and beta values, NUM_ITERATIONS each, against std::gamma_distribution driven by next()
+
+    BENCHMARK_ADVANCED("std::gamma_distribution shape 2.5 with next()")(Catch::Benchmark::Chronometer meter)
+    {
+        NextURBG rng(SEED);
+        std::gamma_distribution<double> distribution(2.5, 1.0);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("Serial fill_gamma() shape 2.5")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_gamma(buffer.data(), buffer.size(), 2.5); });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX gamma4() shape 2.5")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i += 4)
+            {
+                Xoshiro256PlusAVX2::FourDoubleValues next_values(rng.gamma4(2.5));
+
+                buffer[i] = next_values[0];
+                buffer[i + 1] = next_values[1];
+                buffer[i + 2] = next_values[2];
+                buffer[i + 3] = next_values[3];
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_gamma() shape 2.5")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_gamma(buffer.data(), buffer.size(), 2.5); });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("std::gamma_distribution shape 0.5 with next()")(Catch::Benchmark::Chronometer meter)
+    {
+        NextURBG rng(SEED);
+        std::gamma_distribution<double> distribution(0.5, 1.0);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &distribution, &buffer] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                buffer[i] = distribution(rng);
+            }
+        });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_gamma() shape 0.5")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_gamma(buffer.data(), buffer.size(), 0.5); });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("AVX fill_beta() 2, 5")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        std::vector<double> buffer(NUM_ITERATIONS);
+
+        meter.measure([&rng, &buffer] { rng.fill_beta(buffer.data(), buffer.size(), 2.0, 5.0); });
+
+        REQUIRE(buffer[0] != 0.0);
+    };
+
+
+    //  The standard engine adapter against std::mt19937_64, raw and under the std distributions, NUM_ITERATIONS
+    //      values each.  The shuffles are of a NUM_ITERATIONS element vector.
+
+    BENCHMARK_ADVANCED("mt19937_64 operator()")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 engine(SEED);
+
+        uint64_t sum = 0;
+
+        meter.measure([&engine, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += engine();
+            }
+        });
+
+        REQUIRE(sum != 0);
+    };
+
+    BENCHMARK_ADVANCED("Serial engine operator()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusEngineSerial engine(SEED);
+
+        uint64_t sum = 0;
+
+        meter.measure([&engine, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += engine();
+            }
+        });
+
+        REQUIRE(sum != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX engine operator()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusEngineAVX2 engine(SEED);
+
+        uint64_t sum = 0;
+
+        meter.measure([&engine, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += engine();
+            }
+        });
+
+        REQUIRE(sum != 0);
+    };
+
+    BENCHMARK_ADVANCED("AVX engine 4096 block operator()")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusEngineAVX2LargeBlock engine(SEED);
+
+        uint64_t sum = 0;
+
+        meter.measure([&engine, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += engine();
+            }
+        });
+
+        REQUIRE(sum != 0);
+    };
+
+    BENCHMARK_ADVANCED("std::uniform_int_distribution die with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 engine(SEED);
+        std::uniform_int_distribution<int> die(1, 6);
+
+        uint64_t sum = 0;
+
+        meter.measure([&engine, &die, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += die(engine);
+            }
+        });
+
+        REQUIRE(sum != 0);
+    };
+
+    BENCHMARK_ADVANCED("std::uniform_real_distribution with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 engine(SEED);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        double sum = 0;
+
+        meter.measure([&engine, &unit, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += unit(engine);
+            }
+        });
+
+        REQUIRE(sum != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("std::shuffle with mt19937_64")(Catch::Benchmark::Chronometer meter)
+    {
+        std::mt19937_64 engine(SEED);
+
+        std::vector<uint32_t> values(NUM_ITERATIONS);
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = i;
+        }
+
+        meter.measure([&engine, &values] { std::shuffle(values.begin(), values.end(), engine); });
+
+        REQUIRE(values.size() == NUM_ITERATIONS);
+    };
+
+    BENCHMARK_ADVANCED("std::uniform_int_distribution die with AVX engine")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusEngineAVX2 engine(SEED);
+        std::uniform_int_distribution<int> die(1, 6);
+
+        uint64_t sum = 0;
+
+        meter.measure([&engine, &die, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += die(engine);
+            }
+        });
+
+        REQUIRE(sum != 0);
+    };
+
+    BENCHMARK_ADVANCED("std::uniform_real_distribution with AVX engine")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusEngineAVX2 engine(SEED);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        double sum = 0;
+
+        meter.measure([&engine, &unit, &sum] {
+            for (auto i = 0; i < NUM_ITERATIONS; i++)
+            {
+                sum += unit(engine);
+            }
+        });
+
+        REQUIRE(sum != 0.0);
+    };
+
+    BENCHMARK_ADVANCED("std::shuffle with AVX engine")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusEngineAVX2 engine(SEED);
+
+        std::vector<uint32_t> values(NUM_ITERATIONS);
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = i;
+        }
+
+        meter.measure([&engine, &values] { std::shuffle(values.begin(), values.end(), engine); });
+
+        REQUIRE(values.size() == NUM_ITERATIONS);
+    };
+
+    //  Jump ahead costs the same whatever the distance, the 128 bit distance is the worst case for building the
+    //      polynomial.  The one million step loop is for comparison.
+
+    BENCHMARK_ADVANCED("Serial next() 1M steps")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        meter.measure([&rng] {
+            for (auto i = 0; i < 1000000; i++)
+            {
+                rng.next();
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("Serial discard() 1M steps")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        meter.measure([&rng] { rng.discard(1000000); });
+    };
+
+    BENCHMARK_ADVANCED("AVX discard() 1M steps")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        meter.measure([&rng] { rng.discard(1000000); });
+    };
+
+    BENCHMARK_ADVANCED("AVX discard_lanes() 1M steps")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        meter.measure([&rng] { rng.discard_lanes(1000000); });
+    };
+
+    BENCHMARK_ADVANCED("AVX discard() 2^128 - 1 steps")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        meter.measure([&rng] { rng.discard(~__uint128_t(0)); });
+    };
+
+    BENCHMARK_ADVANCED("AVX jump_streams() 1000")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        meter.measure([&rng] { rng.jump_streams(1000); });
+    };
+
+    //  Construction and copying are dominated by the long jumps which separate the lanes, NUM_GENERATORS generators are
+    //      created per measurement.
+
+    constexpr size_t NUM_GENERATORS = 1000;
+
+    BENCHMARK_ADVANCED("Serial construct")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusSerial rng(i);
+
+                sum += rng.next4()[3];
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX construct")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusAVX2 rng(i);
+
+                sum += rng.next4()[3];
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX construct eight lanes")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusAVX2EightLanes rng(i);
+
+                sum += rng.next8()[7];
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    //  Lanes initialized on first use leave a generator which only draws single values paying for the seeding alone.
+
+    BENCHMARK_ADVANCED("Serial construct and first next()")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusSerial rng(i);
+
+                sum += rng.next();
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("Serial lazy construct and first next()")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusSerialLazy rng(i);
+
+                sum += rng.next();
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX construct and first next()")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusAVX2 rng(i);
+
+                sum += rng.next();
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX lazy construct and first next()")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusAVX2Lazy rng(i);
+
+                sum += rng.next();
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX lazy construct and first next4()")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusAVX2Lazy rng(i);
+
+                sum += rng.next4()[3];
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX lazy next4() sum in _m256i")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2Lazy rng(SEED);
+
+        meter.measure([&rng] {
+            __m256i sum = _mm256_setzero_si256();
+
+            for (auto i = 0; i < NUM_ITERATIONS / 4; i++)
+            {
+                sum = _mm256_add_epi64(sum, rng.next4());
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("Serial copy with jump")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusSerial rng(SEED);
+
+        meter.measure([&rng] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusSerial rng_copy(rng, Xoshiro256PlusSerial::JumpOnCopy::Short);
+
+                sum += rng_copy.next4()[3];
+                Catch::Benchmark::keep_memory(&rng_copy);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX copy with jump")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+
+        meter.measure([&rng] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusAVX2 rng_copy(rng, Xoshiro256PlusAVX2::JumpOnCopy::Short);
+
+                sum += rng_copy.next4()[3];
+                Catch::Benchmark::keep_memory(&rng_copy);
+            }
+
+            return sum;
+        });
+    };
+
+    #ifdef __AVX512_AVAILABLE__
+    BENCHMARK_ADVANCED("AVX512 construct")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusAVX512 rng(i);
+
+                sum += rng.next8()[7];
+                Catch::Benchmark::keep_memory(&rng);
+            }
+
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX512 copy with jump")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX512 rng(SEED);
+
+        meter.measure([&rng] {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < NUM_GENERATORS; i++)
+            {
+                Xoshiro256PlusAVX512 rng_copy(rng, Xoshiro256PlusAVX512::JumpOnCopy::Short);
+
+                sum += rng_copy.next8()[7];
+                Catch::Benchmark::keep_memory(&rng_copy);
+            }
+
+            return sum;
+        });
+    };
+    #endif
+
+    BENCHMARK_ADVANCED("Array of single RNGs step")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<Xoshiro256PlusScalarOnly> rngs;
+
+        //  Reserved up front, the RNG copy constructor jumps so the generators must not be moved by the vector.
+
+        rngs.reserve(BANK_STREAMS);
+        std::vector<uint64_t> values(BANK_STREAMS);
+
+        for (size_t i = 0; i < BANK_STREAMS; i++)
+        {
+            rngs.emplace_back(Xoshiro256PlusBankSerial::stream_seed(SEED, i));
+        }
+
+        meter.measure([&rngs, &values] {
+            for (size_t step = 0; step < BANK_STEPS; step++)
+            {
+                for (size_t i = 0; i < BANK_STREAMS; i++)
+                {
+                    values[i] = rngs[i].next();
+                }
+            }
+
+            return values[BANK_STREAMS - 1];
+        });
+    };
+
+    BENCHMARK_ADVANCED("Serial bank step")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusBankSerial bank(BANK_STREAMS, SEED);
+        std::vector<uint64_t> values(BANK_STREAMS);
+
+        meter.measure([&bank, &values] {
+            for (size_t step = 0; step < BANK_STEPS; step++)
+            {
+                bank.next(values.data());
+            }
+
+            return values[BANK_STREAMS - 1];
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX bank step")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusBankAVX2 bank(BANK_STREAMS, SEED);
+        std::vector<uint64_t> values(BANK_STREAMS);
+
+        meter.measure([&bank, &values] {
+            for (size_t step = 0; step < BANK_STEPS; step++)
+            {
+                bank.next(values.data());
+            }
+
+            return values[BANK_STREAMS - 1];
+        });
+    };
+
+    #ifdef __AVX512_AVAILABLE__
+    BENCHMARK_ADVANCED("AVX512 bank step")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusBankAVX512 bank(BANK_STREAMS, SEED);
+        std::vector<uint64_t> values(BANK_STREAMS);
+
+        meter.measure([&bank, &values] {
+            for (size_t step = 0; step < BANK_STEPS; step++)
+            {
+                bank.next(values.data());
+            }
+
+            return values[BANK_STREAMS - 1];
+        });
+    };
+    #endif
+
+    //  Each thread draws from the pool's local() generator on every call.  The unpadded generators are ScalarOnly RNGs
+    //      side by side in a vector, two to a cache line, for comparison.
+
+    for (size_t num_threads : SCALING_THREAD_COUNTS)
+    {
+        BENCHMARK_ADVANCED("Pool local() next() " + std::to_string(num_threads) + " threads")(
+            Catch::Benchmark::Chronometer meter)
+        {
+            Xoshiro256PlusPoolAVX2 pool(SEED);
+            std::vector<uint64_t> sums(num_threads, 0);
+
+            meter.measure([&pool, &sums, num_threads] {
+                run_threads(num_threads, [&pool, &sums, num_threads](size_t thread_index) {
+                    uint64_t sum = 0;
+
+                    for (size_t i = 0; i < NUM_ITERATIONS / num_threads; i++)
+                    {
+                        sum += pool.local().next();
+                    }
+
+                    sums[thread_index] = sum;
+                });
+            });
+
+            REQUIRE(pool.num_generators() >= num_threads);
+        };
+
+        BENCHMARK_ADVANCED("Unpadded generators next() " + std::to_string(num_threads) + " threads")(
+            Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<Xoshiro256PlusScalarOnly> rngs;
+            std::vector<uint64_t> sums(num_threads, 0);
+
+            rngs.reserve(num_threads);
+
+            for (size_t i = 0; i < num_threads; i++)
+            {
+                rngs.emplace_back(SEED + i);
+            }
+
+            meter.measure([&rngs, &sums, num_threads] {
+                run_threads(num_threads, [&rngs, &sums, num_threads](size_t thread_index) {
+                    uint64_t sum = 0;
+
+                    for (size_t i = 0; i < NUM_ITERATIONS / num_threads; i++)
+                    {
+                        sum += rngs[thread_index].next();
+                    }
+
+                    sums[thread_index] = sum;
+                });
+            });
+
+            REQUIRE(sums[0] != 0);
+        };
+    }
+
+    //  One stream shared by all the threads, through a mutex around next() or through block claims by a Reader per
+    //      thread.
+
+    for (size_t num_threads : CONTENTION_THREAD_COUNTS)
+    {
+        BENCHMARK_ADVANCED("Mutex shared next() " + std::to_string(num_threads) + " threads")(
+            Catch::Benchmark::Chronometer meter)
+        {
+            Xoshiro256PlusSerial rng(SEED);
+            std::mutex rng_mutex;
+            std::vector<uint64_t> sums(num_threads, 0);
+
+            meter.measure([&rng, &rng_mutex, &sums, num_threads] {
+                run_threads(num_threads, [&rng, &rng_mutex, &sums, num_threads](size_t thread_index) {
+                    uint64_t sum = 0;
+
+                    for (size_t i = 0; i < NUM_ITERATIONS / num_threads; i++)
+                    {
+                        std::lock_guard<std::mutex> lock(rng_mutex);
+
+                        sum += rng.next();
+                    }
+
+                    sums[thread_index] = sum;
+                });
+            });
+
+            REQUIRE(sums[0] != 0);
+        };
+
+        BENCHMARK_ADVANCED("Shared stream Reader next() " + std::to_string(num_threads) + " threads")(
+            Catch::Benchmark::Chronometer meter)
+        {
+            Xoshiro256PlusSharedAVX2 shared(SEED);
+            std::vector<uint64_t> sums(num_threads, 0);
+
+            meter.measure([&shared, &sums, num_threads] {
+                run_threads(num_threads, [&shared, &sums, num_threads](size_t thread_index) {
+                    Xoshiro256PlusSharedAVX2::Reader reader(shared);
+                    uint64_t sum = 0;
+
+                    for (size_t i = 0; i < NUM_ITERATIONS / num_threads; i++)
+                    {
+                        sum += reader.next();
+                    }
+
+                    sums[thread_index] = sum;
+                });
+            });
+
+            REQUIRE(sums[0] != 0);
+        };
+    }
+
+    BENCHMARK_ADVANCED("AVX fill() 64MB buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        std::vector<uint64_t> buffer(PARALLEL_FILL_COUNT);
+
+        meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+        REQUIRE(buffer[0] != buffer[1]);
+    };
+
+    for (size_t num_threads : SCALING_THREAD_COUNTS)
+    {
+        BENCHMARK_ADVANCED("AVX parallel_fill() 64MB buffer " + std::to_string(num_threads) + " threads")(
+            Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<uint64_t> buffer(PARALLEL_FILL_COUNT);
+
+            meter.measure([&buffer, num_threads] {
+                SEFUtility::RNG::parallel_fill<SIMDInstructionSet::AVX2>(
+                    SEED, buffer.data(), buffer.size(), SEFUtility::RNG::ParallelFill::DEFAULT_CHUNK_SIZE, num_threads);
+            });
+
+            REQUIRE(buffer[0] != buffer[1]);
+        };
+    }
+
+    //  Small and medium fills, where starting threads for each call rather than keeping a pool shows
+
+    for (size_t fill_count : {SMALL_PARALLEL_FILL_COUNT, MEDIUM_PARALLEL_FILL_COUNT})
+    {
+        const std::string buffer_size = std::to_string(fill_count * sizeof(uint64_t) / 1024) + "KB buffer";
+        const size_t chunk_size = fill_count / PARALLEL_FILL_POOL_THREADS;
+
+        BENCHMARK_ADVANCED("AVX fill() " + buffer_size)(Catch::Benchmark::Chronometer meter)
+        {
+            Xoshiro256PlusAVX2 rng(SEED);
+            std::vector<uint64_t> buffer(fill_count);
+
+            meter.measure([&rng, &buffer] { rng.fill(buffer.data(), buffer.size()); });
+
+            REQUIRE(buffer[0] != buffer[1]);
+        };
+
+        BENCHMARK_ADVANCED("AVX parallel_fill() " + buffer_size + " threads per call")(
+            Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<uint64_t> buffer(fill_count);
+
+            meter.measure([&buffer, chunk_size] {
+                SEFUtility::RNG::parallel_fill<SIMDInstructionSet::AVX2>(SEED, buffer.data(), buffer.size(), chunk_size,
+                                                                         PARALLEL_FILL_POOL_THREADS);
+            });
+
+            REQUIRE(buffer[0] != buffer[1]);
+        };
+
+        BENCHMARK_ADVANCED("AVX parallel_fill() " + buffer_size + " thread pool")(Catch::Benchmark::Chronometer meter)
+        {
+            SEFUtility::RNG::ParallelFill::ThreadPool pool(PARALLEL_FILL_POOL_THREADS);
+            std::vector<uint64_t> buffer(fill_count);
+
+            meter.measure([&pool, &buffer, chunk_size] {
+                SEFUtility::RNG::parallel_fill<SIMDInstructionSet::AVX2>(pool, SEED, buffer.data(), buffer.size(),
+                                                                         chunk_size);
+            });
+
+            REQUIRE(buffer[0] != buffer[1]);
+        };
+    }
+
+    //  The consumer sums NUM_ITERATIONS values a block at a time, generating each block itself or taking it from the
+    //      background producer.  With a spare core the producer's time is the consumer's sum alone.
+
+    BENCHMARK_ADVANCED("AVX fill() blocks inline")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusAVX2 rng(SEED);
+        alignas(64) std::array<uint64_t, Xoshiro256PlusProducerAVX2::block_size()> block;
+
+        uint64_t sum = 0;
+
+        meter.measure([&rng, &block, &sum] {
+            for (size_t i = 0; i < NUM_ITERATIONS; i += block.size())
+            {
+                rng.fill(block.data(), block.size());
+
+                for (auto value : block)
+                {
+                    sum += value;
+                }
+            }
+        });
+
+        REQUIRE(sum != 0);
+    };
+
+    BENCHMARK_ADVANCED("Producer pop() blocks")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusProducerAVX2 producer(SEED, 16);
+
+        uint64_t sum = 0;
+
+        meter.measure([&producer, &sum] {
+            for (size_t i = 0; i < NUM_ITERATIONS; i += Xoshiro256PlusProducerAVX2::block_size())
+            {
+                const uint64_t* block = producer.pop();
+
+                for (size_t j = 0; j < Xoshiro256PlusProducerAVX2::block_size(); j++)
+                {
+                    sum += block[j];
+                }
+            }
+        });
+
+        REQUIRE(sum != 0);
+    };
+
+    BENCHMARK_ADVANCED("Producer pop() double blocks")(Catch::Benchmark::Chronometer meter)
+    {
+        Xoshiro256PlusDoubleProducerAVX2 producer(SEED, 16);
+
+        double sum = 0;
+
+        meter.measure([&producer, &sum] {
+            for (size_t i = 0; i < NUM_ITERATIONS; i += Xoshiro256PlusDoubleProducerAVX2::block_size())
+            {
+                const double* block = producer.pop();
+
+                for (size_t j = 0; j < Xoshiro256PlusDoubleProducerAVX2::block_size(); j++)
+                {
+                    sum += block[j];
+                }
+            }
+        });
+
+        REQUIRE(sum != 0.0);
+    };
     #endif
-}
\ No newline at end of file
+}
@@ -25,5 +25,6 @@ enum class SIMDInstructionSet
 {
     NONE = 0,
     AVX = 1,
-    AVX2 = 2
+    AVX2 = 2,
+    AVX512 = 3
 };
\ No newline at end of file
@@ -40,15 +40,90 @@ See <http://creativecommons.org/publicdomain/zero/1.0/>. */
 #include <assert.h>
 #include <immintrin.h>
 #include <stdint.h>
+#include <string.h>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <limits>
+#include <type_traits>
+
+#if __has_include(<span>) && (__cplusplus > 201703L)
+#include <span>
+#endif
 
 #include "SplitMix64.h"
+#include "Xoshiro256PlusJumpPolynomial.h"
+#include "Xoshiro256PlusSmallRange.h"
+#include "Xoshiro256PlusZiggurat.h"
+
+//
+//  The serial, AVX2 and AVX512 instances return bit identical doubles and floats - the unit interval conversions,
+//      the bounded ranges and the normal, exponential, gamma and other distributions - only if the compiler evaluates
+//      each multiply and add as written.  Once FMA instructions are enabled, by -mfma, -march=native or AVX512, GCC's
+//      default of -ffp-contract=fast (and clang's -ffp-contract=on) may fuse a multiply and an add in one path and
+//      not in the other, and the last bit of the results can differ.  Code depending on identical results should be
+//      built with -ffp-contract=off and define XOSHIRO256PLUS_FP_CONTRACT_OFF to say so, which silences the warning
+//      below.  The integer values are not affected.
+//
+
+#if defined(__FMA__) && !defined(XOSHIRO256PLUS_FP_CONTRACT_OFF)
+#warning "FMA is enabled: build with -ffp-contract=off and define XOSHIRO256PLUS_FP_CONTRACT_OFF for bit identical serial and SIMD doubles"
+#endif
 
 namespace SEFUtility::RNG
 {
-    template <SIMDInstructionSet SIMD>
+    //
+    //  The LANES template parameter sets the number of independent streams held by the RNG for the wide operations.
+    //      next4() uses the first four lanes, next8() the first eight and next16() all sixteen, so an instance only
+    //      carries (and only pays to seed) the lanes it needs.  AVX512 instances step lanes eight at a time and so
+    //      need at least eight.
+    //
+    //  The LANE_INIT template parameter chooses when the lanes are derived from the seed.  OnConstruction pays for the
+    //      long jumps up front.  OnFirstUse defers them to the first wide call or fill, so a generator which only
+    //      calls next() or dnext() costs no more than the SplitMix64 seeding - at the price of a check on every wide
+    //      call, which keeps the compiler from holding the state in registers across a tight loop.  The streams are
+    //      identical either way.
+    //
+    //  The LAYOUT template parameter chooses the state an instance carries:
+    //
+    //      Full        the serial state, the serial lanes and, for AVX2 and AVX512 instances, the SIMD blocks.  This
+    //                      is the original layout, AVX2 and AVX512 instances never touch the serial lanes.
+    //      SIMDOnly    the serial state and the SIMD blocks, the default for AVX2 and AVX512 instances
+    //      ScalarOnly  the serial state alone - 32 bytes, for next(), dnext() and the jumps only
+    //
+    //  NONE instances default to Full, which for them is the serial state and the serial lanes.  The footprints are
+    //      checked by the static_asserts following the class.
+    //
+
+    enum class LaneInitialization
+    {
+        OnConstruction = 0,
+        OnFirstUse
+    };
+
+    enum class StateLayout
+    {
+        Full = 0,
+        SIMDOnly,
+        ScalarOnly
+    };
+
+    //  The conversions from a 64 bit draw to a double offered by the dnext<UnitInterval>() family, see dnext4() for
+    //      the details of each.
+
+    enum class UnitInterval
+    {
+        ClosedOpen52 = 0,
+        ClosedOpen53,
+        Open,
+        Closed,
+        Dense
+    };
+
+    template <SIMDInstructionSet SIMD, size_t LANES = (SIMD >= SIMDInstructionSet::AVX512 ? 8 : 4),
+              LaneInitialization LANE_INIT = LaneInitialization::OnConstruction,
+              StateLayout LAYOUT = (SIMD >= SIMDInstructionSet::AVX2 ? StateLayout::SIMDOnly : StateLayout::Full)>
     class Xoshiro256Plus
     {
        public:
@@ -128,6 +203,173 @@ namespace SEFUtility::RNG
             friend class Xoshiro256Plus;
         };
 
+        //
+        //  Eight uint32s or floats from a single four wide step
+        //
+
+        class EightUInt32Values
+        {
+           public:
+            EightUInt32Values& operator=(EightUInt32Values) = delete;
+            EightUInt32Values& operator=(const EightUInt32Values&) = delete;
+            EightUInt32Values& operator=(EightUInt32Values&&) = delete;
+
+#ifdef __AVX2_AVAILABLE__
+            operator __m256i() const { return result_packed_; }
+#endif
+
+            uint32_t operator[](size_t index) const { return ((__v8su)result_packed_)[index]; }
+
+           private:
+            alignas(32) __m256i result_packed_;
+
+            EightUInt32Values(__m256i value) : result_packed_(std::move(value)) {}
+
+            EightUInt32Values(EightUInt32Values&& value_to_copy)
+                : result_packed_(std::move(value_to_copy.result_packed_))
+            {
+            }
+
+            EightUInt32Values(EightUInt32Values& value_to_copy) = delete;
+            EightUInt32Values(const EightUInt32Values& value_to_copy) = delete;
+
+            friend class Xoshiro256Plus;
+        };
+
+        class EightFloatValues
+        {
+           public:
+            EightFloatValues& operator=(EightFloatValues) = delete;
+            EightFloatValues& operator=(const EightFloatValues&) = delete;
+            EightFloatValues& operator=(EightFloatValues&&) = delete;
+
+#ifdef __AVX2_AVAILABLE__
+            operator __m256() const { return result_packed_; }
+#endif
+
+            float operator[](size_t index) const { return result_packed_[index]; }
+
+           private:
+            alignas(32) __m256 result_packed_;
+
+            EightFloatValues(__m256 value) : result_packed_(std::move(value)) {}
+
+            EightFloatValues(EightFloatValues&& value_to_copy) : result_packed_(std::move(value_to_copy.result_packed_))
+            {
+            }
+
+            EightFloatValues(EightFloatValues& value_to_copy) = delete;
+            EightFloatValues(const EightFloatValues& value_to_copy) = delete;
+
+            friend class Xoshiro256Plus;
+        };
+
+        //
+        //  Eight or more values at a time are held as a group of packed registers, four-wide for AVX2 or
+        //      eight-wide for AVX512.  packed4() and packed8() return the registers, operator[] the individual values.
+        //
+
+        template <size_t NUM_VALUES>
+        class WideIntegerValues
+        {
+           public:
+            WideIntegerValues& operator=(WideIntegerValues) = delete;
+            WideIntegerValues& operator=(const WideIntegerValues&) = delete;
+            WideIntegerValues& operator=(WideIntegerValues&&) = delete;
+
+#ifdef __AVX512_AVAILABLE__
+            operator __m512i() const
+            {
+                static_assert(NUM_VALUES == 8, "Only eight values convert to a single __m512i");
+                return result_packed8_[0];
+            }
+
+            __m512i packed8(size_t index) const { return result_packed8_[index]; }
+#endif
+
+#ifdef __AVX2_AVAILABLE__
+            __m256i packed4(size_t index) const { return result_packed4_[index]; }
+#endif
+
+            uint64_t operator[](size_t index) const { return result_packed4_[index / 4][index % 4]; }
+
+           private:
+            union alignas(64)
+            {
+                __m512i result_packed8_[NUM_VALUES / 8];
+                __m256i result_packed4_[NUM_VALUES / 4];
+            };
+
+            WideIntegerValues() {}
+
+            WideIntegerValues(WideIntegerValues&& value_to_copy)
+            {
+                for (size_t i = 0; i < NUM_VALUES / 4; i++)
+                {
+                    result_packed4_[i] = value_to_copy.result_packed4_[i];
+                }
+            }
+
+            WideIntegerValues(WideIntegerValues& value_to_copy) = delete;
+            WideIntegerValues(const WideIntegerValues& value_to_copy) = delete;
+
+            friend class Xoshiro256Plus;
+        };
+
+        template <size_t NUM_VALUES>
+        class WideDoubleValues
+        {
+           public:
+            WideDoubleValues& operator=(WideDoubleValues) = delete;
+            WideDoubleValues& operator=(const WideDoubleValues&) = delete;
+            WideDoubleValues& operator=(WideDoubleValues&&) = delete;
+
+#ifdef __AVX512_AVAILABLE__
+            operator __m512d() const
+            {
+                static_assert(NUM_VALUES == 8, "Only eight values convert to a single __m512d");
+                return result_packed8_[0];
+            }
+
+            __m512d packed8(size_t index) const { return result_packed8_[index]; }
+#endif
+
+#ifdef __AVX2_AVAILABLE__
+            __m256d packed4(size_t index) const { return result_packed4_[index]; }
+#endif
+
+            double operator[](size_t index) const { return result_packed4_[index / 4][index % 4]; }
+
+           private:
+            union alignas(64)
+            {
+                __m512d result_packed8_[NUM_VALUES / 8];
+                __m256d result_packed4_[NUM_VALUES / 4];
+            };
+
+            WideDoubleValues() {}
+
+            WideDoubleValues(WideDoubleValues&& value_to_copy)
+            {
+                for (size_t i = 0; i < NUM_VALUES / 4; i++)
+                {
+                    result_packed4_[i] = value_to_copy.result_packed4_[i];
+                }
+            }
+
+            WideDoubleValues(WideDoubleValues& value_to_copy) = delete;
+            WideDoubleValues(const WideDoubleValues& value_to_copy) = delete;
+
+            friend class Xoshiro256Plus;
+        };
+
+        typedef WideIntegerValues<8> EightIntegerValues;
+        typedef WideDoubleValues<8> EightDoubleValues;
+        typedef WideIntegerValues<16> SixteenIntegerValues;
+        typedef WideDoubleValues<16> SixteenDoubleValues;
+
+        static constexpr size_t NUM_LANES = LANES;
+
         enum class JumpOnCopy : int32_t
         {
             None = 0,
@@ -138,12 +380,22 @@ namespace SEFUtility::RNG
         Xoshiro256Plus(const uint64_t seed)
         {
             static_assert(SIMD != SIMDInstructionSet::AVX, "AVX RNG is not supported - just use NONE");
+            static_assert((LANES == 4) || (LANES == 8) || (LANES == 16), "RNG supports four, eight or sixteen lanes");
+            static_assert((LANES % LANES_PER_SIMD_BLOCK) == 0, "AVX512 RNG requires at least eight lanes");
 
 #ifndef __AVX2_AVAILABLE__
             static_assert(SIMD == SIMDInstructionSet::NONE,
                           "Cannot have an AVX2 RNG if AVX2 extensions are not available");
 #endif
 
+#ifndef __AVX512_AVAILABLE__
+            static_assert(SIMD < SIMDInstructionSet::AVX512,
+                          "Cannot have an AVX512 RNG if AVX512 extensions are not available");
+#endif
+
+            static_assert((LAYOUT != StateLayout::SIMDOnly) || (SIMD >= SIMDInstructionSet::AVX2),
+                          "SIMDOnly layout requires an AVX2 or AVX512 RNG");
+
             SplitMix64 split_mix(seed);
 
             serial_state_[0] = split_mix.next();
@@ -151,41 +403,36 @@ namespace SEFUtility::RNG
             serial_state_[2] = split_mix.next();
             serial_state_[3] = split_mix.next();
 
-            serial_next4_state_[0] = long_jump(serial_state_);
-            serial_next4_state_[1] = long_jump(serial_next4_state_[0]);
-            serial_next4_state_[2] = long_jump(serial_next4_state_[1]);
-            serial_next4_state_[3] = long_jump(serial_next4_state_[2]);
-
-            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
-            {
-                simd_state_ = SIMDState(serial_next4_state_);
-            }
+            seed_lanes();
         }
 
         Xoshiro256Plus(const std::array<uint64_t, 4> seed) : serial_state_(seed)
         {
             static_assert(SIMD != SIMDInstructionSet::AVX, "AVX RNG is not supported - just use NONE");
+            static_assert((LANES == 4) || (LANES == 8) || (LANES == 16), "RNG supports four, eight or sixteen lanes");
+            static_assert((LANES % LANES_PER_SIMD_BLOCK) == 0, "AVX512 RNG requires at least eight lanes");
 
 #ifndef __AVX2_AVAILABLE__
             static_assert(SIMD == SIMDInstructionSet::NONE,
                           "Cannot have an AVX2 RNG if AVX2 extensions are not available");
 #endif
 
-            serial_next4_state_[0] = long_jump(serial_state_);
-            serial_next4_state_[1] = long_jump(serial_next4_state_[0]);
-            serial_next4_state_[2] = long_jump(serial_next4_state_[1]);
-            serial_next4_state_[3] = long_jump(serial_next4_state_[2]);
+#ifndef __AVX512_AVAILABLE__
+            static_assert(SIMD < SIMDInstructionSet::AVX512,
+                          "Cannot have an AVX512 RNG if AVX512 extensions are not available");
+#endif
 
-            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
-            {
-                simd_state_ = SIMDState(serial_next4_state_);
-            }
+            static_assert((LAYOUT != StateLayout::SIMDOnly) || (SIMD >= SIMDInstructionSet::AVX2),
+                          "SIMDOnly layout requires an AVX2 or AVX512 RNG");
+
+            seed_lanes();
         }
 
-        Xoshiro256Plus(const Xoshiro256Plus<SIMD>& rng_to_copy, JumpOnCopy jump_dist = JumpOnCopy::Short)
+        Xoshiro256Plus(const Xoshiro256Plus& rng_to_copy, JumpOnCopy jump_dist = JumpOnCopy::Short)
             : serial_state_(rng_to_copy.serial_state_),
-              serial_next4_state_(rng_to_copy.serial_next4_state_),
-              simd_state_(rng_to_copy.simd_state_, jump_dist)
+              serial_lanes_state_(rng_to_copy.serial_lanes_state_),
+              simd_state_(rng_to_copy.simd_state_),
+              lanes_initialized_(rng_to_copy.lanes_initialized_)
         {
             switch (jump_dist)
             {
@@ -194,22 +441,49 @@ namespace SEFUtility::RNG
 
                 case JumpOnCopy::Short:
                     serial_state_ = jump(serial_state_);
-                    serial_next4_state_[0] = jump(serial_next4_state_[0]);
-                    serial_next4_state_[1] = jump(serial_next4_state_[1]);
-                    serial_next4_state_[2] = jump(serial_next4_state_[2]);
-                    serial_next4_state_[3] = jump(serial_next4_state_[3]);
                     break;
 
                 case JumpOnCopy::Long:
                     serial_state_ = long_jump(serial_state_);
-                    serial_next4_state_[0] = long_jump(serial_next4_state_[0]);
-                    serial_next4_state_[1] = long_jump(serial_next4_state_[1]);
-                    serial_next4_state_[2] = long_jump(serial_next4_state_[2]);
-                    serial_next4_state_[3] = long_jump(serial_next4_state_[3]);
                     break;
             }
+
+            //  Jumps commute, so until the lanes are derived jumping their seed is the same as jumping every lane.
+            //      The SIMD blocks jump all of their lanes at once, the serial lanes are only used by NONE instances.
+
+            if constexpr (LAYOUT != StateLayout::ScalarOnly)
+            {
+                if (jump_dist == JumpOnCopy::None)
+                {
+                    return;
+                }
+
+                if (lanes_deferred())
+                {
+                    set_lane_seed((jump_dist == JumpOnCopy::Short) ? jump(lane_seed()) : long_jump(lane_seed()));
+                }
+                else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+                {
+                    for (auto& block_state : simd_state_)
+                    {
+                        block_state = SIMDBlock(block_state, jump_dist);
+                    }
+                }
+                else
+                {
+                    for (auto& lane_state : serial_lanes_state_)
+                    {
+                        lane_state = (jump_dist == JumpOnCopy::Short) ? jump(lane_state) : long_jump(lane_state);
+                    }
+                }
+            }
         }
 
+        //  Assignment copies the state as it is, as a copy with JumpOnCopy::None would.  Declared explicitly, the
+        //      implicit copy assignment of a class with a user declared copy constructor is deprecated.
+
+        Xoshiro256Plus& operator=(const Xoshiro256Plus& rng_to_copy) = default;
+
         //
         //  Single uint64 at a time
         //
@@ -226,6 +500,120 @@ namespace SEFUtility::RNG
                    (uint64_t)lower_bound;
         }
 
+        //  Unbiased bounding with Lemire's nearly divisionless method - the low 32 bits of the product are checked
+        //      against 2^32 mod range and the value is redrawn when it falls in the short, over represented interval.
+        //      The modulus is only computed when the low bits are below range, which is rare for small ranges.
+
+        uint64_t next_unbiased(uint32_t lower_bound, uint32_t upper_bound)
+        {
+            assert(upper_bound > lower_bound);
+
+            const uint32_t range = upper_bound - lower_bound;
+
+            uint64_t product = (uint64_t)((uint32_t)next()) * range;
+
+            if (__builtin_expect((uint32_t)product < range, 0))
+            {
+                const uint32_t threshold = (uint32_t)(-range) % range;
+
+                while ((uint32_t)product < threshold)
+                {
+                    product = (uint64_t)((uint32_t)next()) * range;
+                }
+            }
+
+            return (product >> 32) + (uint64_t)lower_bound;
+        }
+
+        //  Compile time bounds, the same values as next(lower, upper) and next_unbiased(lower, upper) with the range
+        //      and the rejection threshold folded into constants.  Power of two ranges shift the low 32 bits instead
+        //      of multiplying and can never reject.
+
+        template <uint32_t LOWER, uint32_t UPPER>
+        uint64_t next()
+        {
+            static_assert(UPPER > LOWER, "Upper bound must be greater than lower bound");
+
+            constexpr uint32_t RANGE = UPPER - LOWER;
+
+            if constexpr (RANGE == 1)
+            {
+                next();
+
+                return LOWER;
+            }
+            else if constexpr ((RANGE & (RANGE - 1)) == 0)
+            {
+                return (uint64_t)((uint32_t)next() >> (32 - log2_of_power_of_two(RANGE))) + LOWER;
+            }
+            else
+            {
+                return (((uint64_t)((uint32_t)next()) * RANGE) >> 32) + LOWER;
+            }
+        }
+
+        template <uint32_t LOWER, uint32_t UPPER>
+        uint64_t next_unbiased()
+        {
+            static_assert(UPPER > LOWER, "Upper bound must be greater than lower bound");
+
+            constexpr uint32_t RANGE = UPPER - LOWER;
+
+            if constexpr ((RANGE & (RANGE - 1)) == 0)
+            {
+                return next<LOWER, UPPER>();
+            }
+            else
+            {
+                constexpr uint32_t THRESHOLD = lane_threshold(RANGE);
+
+                uint64_t product = (uint64_t)((uint32_t)next()) * RANGE;
+
+                while (__builtin_expect((uint32_t)product < THRESHOLD, 0))
+                {
+                    product = (uint64_t)((uint32_t)next()) * RANGE;
+                }
+
+                return (product >> 32) + LOWER;
+            }
+        }
+
+        //  Bounding with uint64 bounds - the high 64 bits of the 128 bit product of a full 64 bit value and the range.
+
+        uint64_t next_64(uint64_t lower_bound, uint64_t upper_bound)
+        {
+            assert(upper_bound > lower_bound);
+
+            return (uint64_t)(((__uint128_t)next() * (upper_bound - lower_bound)) >> 64) + lower_bound;
+        }
+
+        //  K values in [0, range) carved from as few next() draws as the range allows, see Xoshiro256PlusSmallRange.h.
+        //      Whatever is left of the last draw is discarded, SmallRangeDraw keeps it for the next call.
+
+        template <size_t K>
+        std::array<uint32_t, K> next_small(uint32_t range)
+        {
+            assert(range > 0);
+
+            const uint32_t values_per_draw = SmallRange::values_per_draw(range);
+
+            std::array<uint32_t, K> values;
+
+            uint64_t fraction = 0;
+
+            for (size_t i = 0; i < K; i++)
+            {
+                if ((i % values_per_draw) == 0)
+                {
+                    fraction = next();
+                }
+
+                values[i] = SmallRange::take(fraction, range);
+            }
+
+            return values;
+        }
+
         //
         //  Four uint64s at a time
         //
@@ -234,14 +622,18 @@ namespace SEFUtility::RNG
 
         FourIntegerValues next4()
         {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for next4()");
+
+            ensure_lanes_initialized();
+
             if constexpr (SIMD >= SIMDInstructionSet::AVX2)
             {
-                return simd_next4_internal(simd_state_);
+                return simd_next4_internal(simd_state_[0]);
             }
             else
             {
-                return FourIntegerValues(next_internal(serial_next4_state_[0]), next_internal(serial_next4_state_[1]),
-                                         next_internal(serial_next4_state_[2]), next_internal(serial_next4_state_[3]));
+                return FourIntegerValues(next_internal(serial_lanes_state_[0]), next_internal(serial_lanes_state_[1]),
+                                         next_internal(serial_lanes_state_[2]), next_internal(serial_lanes_state_[3]));
             }
         }
 
@@ -273,306 +665,3270 @@ namespace SEFUtility::RNG
             }
         }
 
-        //
-        //  Single double in range [0,1] for default or [lower, upper] when bounds applied
-        //
+        //  Compile time bounds four at a time, the same values as next4(lower, upper) and next4_unbiased(lower, upper).
 
-        double dnext(void)
+        template <uint32_t LOWER, uint32_t UPPER>
+        FourIntegerValues next4()
         {
-            union
-            {
-                uint64_t int_value;
-                double double_value;
-            };
+            static_assert(UPPER > LOWER, "Upper bound must be greater than lower bound");
 
-            int_value = (next() >> 12) | DOUBLE_MASK;
-
-            return double_value - 1.0;
-        }
-
-        double dnext(double lower_bound, double upper_bound)
-        {
-            return (dnext() * (upper_bound - lower_bound)) + lower_bound;
-        }
+            constexpr uint32_t RANGE = UPPER - LOWER;
 
-        //
-        //  Four doubles at a time - same bounding as single double
-        //
+            auto four_ints = next4();
 
-        FourDoubleValues dnext4()
-        {
-            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            if constexpr (RANGE == 1)
             {
-                union
-                {
-                    __m256i result_packed_int;
-                    __m256d result_packed_double;
-                };
-
-                result_packed_int = _mm256_or_si256(DOUBLE_MASK_PACKED, _mm256_srli_epi64(next4(), 12));
-
-                return _mm256_sub_pd(result_packed_double, ONE_PACKED_DOUBLE);
+                return cnstexpr_mm256_set1_epi64x(LOWER);
+            }
+            else if constexpr ((SIMD >= SIMDInstructionSet::AVX2) && ((RANGE & (RANGE - 1)) == 0))
+            {
+                return _mm256_add_epi64(
+                    _mm256_srli_epi64(_mm256_slli_epi64(four_ints, 32), 64 - log2_of_power_of_two(RANGE)),
+                    _mm256_set1_epi64x(LOWER));
+            }
+            else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return _mm256_add_epi64(_mm256_srli_epi64(_mm256_mul_epu32(four_ints, _mm256_set1_epi64x(RANGE)), 32),
+                                        _mm256_set1_epi64x(LOWER));
             }
             else
             {
-                union
+                for (size_t i = 0; i < 4; i++)
                 {
-                    uint64_t int_value;
-                    double double_value;
-                };
+                    four_ints.result_packed_[i] = (((uint64_t)((uint32_t)four_ints[i]) * RANGE) >> 32) + LOWER;
+                }
 
-                __m256d packed_result;
+                return four_ints;
+            }
+        }
 
-                int_value = (next_internal(serial_next4_state_[0]) >> 12) | DOUBLE_MASK;
-                packed_result[0] = double_value - 1.0;
+        template <uint32_t LOWER, uint32_t UPPER>
+        FourIntegerValues next4_unbiased()
+        {
+            static_assert(UPPER > LOWER, "Upper bound must be greater than lower bound");
 
-                int_value = (next_internal(serial_next4_state_[1]) >> 12) | DOUBLE_MASK;
+            constexpr uint32_t RANGE = UPPER - LOWER;
+
+            if constexpr ((RANGE & (RANGE - 1)) == 0)
+            {
+                return next4<LOWER, UPPER>();
+            }
+            else
+            {
+                return next4_unbiased_internal(cnstexpr_mm256_set1_epi64x(LOWER), cnstexpr_mm256_set1_epi64x(RANGE),
+                                               []() { return cnstexpr_mm256_set1_epi64x(lane_threshold(RANGE)); });
+            }
+        }
+
+        //  Four at a time with uint64 bounds, the same reduction as next_64().  AVX2 has no 64 bit high multiply, so
+        //      the high half of the product is assembled from four 32 bit partial products.  AVX512 does not help
+        //      either - vpmullq only gives the low half and IFMA works on 52 bit limbs - so AVX512 instances use the
+        //      same partial products.
+
+        FourIntegerValues next4_64(uint64_t lower_bound, uint64_t upper_bound)
+        {
+            assert(upper_bound > lower_bound);
+
+            const uint64_t range = upper_bound - lower_bound;
+
+            auto four_ints = next4();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return _mm256_add_epi64(mulhi_epu64(four_ints, _mm256_set1_epi64x(range)),
+                                        _mm256_set1_epi64x(lower_bound));
+            }
+            else
+            {
+                four_ints.result_packed_[0] = (uint64_t)(((__uint128_t)four_ints[0] * range) >> 64) + lower_bound;
+                four_ints.result_packed_[1] = (uint64_t)(((__uint128_t)four_ints[1] * range) >> 64) + lower_bound;
+                four_ints.result_packed_[2] = (uint64_t)(((__uint128_t)four_ints[2] * range) >> 64) + lower_bound;
+                four_ints.result_packed_[3] = (uint64_t)(((__uint128_t)four_ints[3] * range) >> 64) + lower_bound;
+
+                return four_ints;
+            }
+        }
+
+        //  Unbiased four at a time, the same threshold check as next_unbiased() applied to each lane.  All four lanes
+        //      step together, so a rejection draws a new set of four and only the rejected lanes take their new
+        //      value - the lanes which were accepted advance but keep their first value.  The AVX2 and serial lanes
+        //      reject and advance identically.
+
+        FourIntegerValues next4_unbiased(uint32_t lower_bound, uint32_t upper_bound)
+        {
+            assert(upper_bound > lower_bound);
+
+            const uint32_t range = upper_bound - lower_bound;
+
+            return next4_unbiased_internal(cnstexpr_mm256_set1_epi64x(lower_bound), cnstexpr_mm256_set1_epi64x(range),
+                                           [range]() { return cnstexpr_mm256_set1_epi64x(lane_threshold(range)); });
+        }
+
+        //  Per lane bounds, lane i is reduced to [lower_bounds[i], upper_bounds[i]).  Each lane gives exactly the
+        //      value the scalar formula of next(lower, upper) gives for that lane's next value, so a shuffle or a tree
+        //      descent can draw four different ranges in one step.  The packed overloads take one uint32 bound in
+        //      each 64 bit lane.
+
+        FourIntegerValues next4(const std::array<uint32_t, 4>& lower_bounds,
+                                const std::array<uint32_t, 4>& upper_bounds)
+        {
+            return next4(packed_lanes(lower_bounds), packed_lanes(upper_bounds));
+        }
+
+        FourIntegerValues next4(const __m256i lower_bounds, const __m256i upper_bounds)
+        {
+            assert_lane_bounds(lower_bounds, upper_bounds);
+
+            auto four_ints = next4();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return _mm256_add_epi64(
+                    _mm256_srli_epi64(_mm256_mul_epu32(four_ints, _mm256_sub_epi64(upper_bounds, lower_bounds)), 32),
+                    lower_bounds);
+            }
+            else
+            {
+                for (size_t i = 0; i < 4; i++)
+                {
+                    const uint64_t range = (uint32_t)upper_bounds[i] - (uint32_t)lower_bounds[i];
+
+                    four_ints.result_packed_[i] =
+                        (((uint64_t)((uint32_t)four_ints[i]) * range) >> 32) + (uint64_t)(uint32_t)lower_bounds[i];
+                }
+
+                return four_ints;
+            }
+        }
+
+        FourIntegerValues next4_unbiased(const std::array<uint32_t, 4>& lower_bounds,
+                                         const std::array<uint32_t, 4>& upper_bounds)
+        {
+            return next4_unbiased(packed_lanes(lower_bounds), packed_lanes(upper_bounds));
+        }
+
+        FourIntegerValues next4_unbiased(const __m256i lower_bounds, const __m256i upper_bounds)
+        {
+            assert_lane_bounds(lower_bounds, upper_bounds);
+
+            const __m256i ranges = upper_bounds - lower_bounds;
+
+            return next4_unbiased_internal(lower_bounds, ranges, [ranges]() {
+                return (__m256i)(__v4di){lane_threshold(ranges[0]), lane_threshold(ranges[1]),
+                                         lane_threshold(ranges[2]), lane_threshold(ranges[3])};
+            });
+        }
+
+        //
+        //  Single double in range [0,1) for default or [lower, upper) when bounds applied
+        //
+
+        double dnext(void)
+        {
+            union
+            {
+                uint64_t int_value;
+                double double_value;
+            };
+
+            int_value = (next() >> 12) | DOUBLE_MASK;
+
+            return double_value - 1.0;
+        }
+
+        double dnext(double lower_bound, double upper_bound)
+        {
+            return (dnext() * (upper_bound - lower_bound)) + lower_bound;
+        }
+
+        //
+        //  Four doubles at a time - same bounding as single double
+        //
+
+        FourDoubleValues dnext4()
+        {
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                union
+                {
+                    __m256i result_packed_int;
+                    __m256d result_packed_double;
+                };
+
+                result_packed_int = _mm256_or_si256(DOUBLE_MASK_PACKED, _mm256_srli_epi64(next4(), 12));
+
+                return _mm256_sub_pd(result_packed_double, ONE_PACKED_DOUBLE);
+            }
+            else
+            {
+                union
+                {
+                    uint64_t int_value;
+                    double double_value;
+                };
+
+                __m256d packed_result;
+
+                static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for dnext4()");
+
+                ensure_lanes_initialized();
+
+                int_value = (next_internal(serial_lanes_state_[0]) >> 12) | DOUBLE_MASK;
+                packed_result[0] = double_value - 1.0;
+
+                int_value = (next_internal(serial_lanes_state_[1]) >> 12) | DOUBLE_MASK;
                 packed_result[1] = double_value - 1.0;
 
-                int_value = (next_internal(serial_next4_state_[2]) >> 12) | DOUBLE_MASK;
+                int_value = (next_internal(serial_lanes_state_[2]) >> 12) | DOUBLE_MASK;
                 packed_result[2] = double_value - 1.0;
 
-                int_value = (next_internal(serial_next4_state_[3]) >> 12) | DOUBLE_MASK;
-                packed_result[3] = double_value - 1.0;
+                int_value = (next_internal(serial_lanes_state_[3]) >> 12) | DOUBLE_MASK;
+                packed_result[3] = double_value - 1.0;
+
+                return packed_result;
+            }
+        }
+
+        FourDoubleValues dnext4(double lower_bound, double upper_bound)
+        {
+            union
+            {
+                std::array<double, 4> upper_bounded_array;
+                __m256d upper_bounded_packed_double;
+            };
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return _mm256_add_pd( _mm256_mul_pd( dnext4(), _mm256_set1_pd( upper_bound - lower_bound) ), _mm256_set1_pd(lower_bound));
+            }
+            else
+            {
+                auto    result = dnext4();
+
+                result.result_packed_[0] = ( result.result_packed_[0] * ( upper_bound - lower_bound)) + lower_bound;
+                result.result_packed_[1] = ( result.result_packed_[1] * ( upper_bound - lower_bound)) + lower_bound;
+                result.result_packed_[2] = ( result.result_packed_[2] * ( upper_bound - lower_bound)) + lower_bound;
+                result.result_packed_[3] = ( result.result_packed_[3] * ( upper_bound - lower_bound)) + lower_bound;
+            
+                return result;
+            }
+        }
+
+        //
+        //  Doubles on a chosen unit interval
+        //
+        //  dnext() and dnext4() take the upper 52 bits of a draw as the mantissa of a double in [1,2) and subtract
+        //      one - the cheapest conversion, but the values lie on a 2^-52 grid, 0 can come up and the lowest bit of
+        //      a double in [0.5,1) is always zero.  The UnitInterval overloads choose the conversion per call, so a
+        //      hot path can trade speed for the interval it needs:
+        //
+        //      ClosedOpen52    [0,1), the dnext() conversion
+        //      ClosedOpen53    [0,1), (x >> 11) * 2^-53 - every double in [0.5,1) can come up
+        //      Open            (0,1), ((x >> 12) + 0.5) * 2^-52 - the 2^-52 grid moved up half a step, so log(U) and
+        //                          1 / U need no check for zero
+        //      Closed          [0,1], (((x >> 10) + 1) >> 1) * 2^-53 - the 54 bit fraction rounded to the nearest
+        //                          point of the 2^-53 grid, so 0 and 1 each come up half as often as the other points
+        //      Dense           [0,1), x * 2^-64 truncated to 53 significant bits - below 2^-11 the spacing keeps
+        //                          shrinking with the value, down to 2^-64, rather than stopping at 2^-53
+        //
+        //  AVX2 has no 64 bit integer to double conversion.  The 53 bit and Dense conversions convert the upper and
+        //      lower 32 bits with the 2^52 trick and add them, which is exact as the sum fits in a mantissa.  Dense
+        //      finds the leading bit of x from the exponent of the exact conversion of x >> 11 and clears the bits
+        //      below the 53 it keeps.  All of the conversions are exact apart from the intended truncation, so the
+        //      serial and SIMD values are identical.
+        //
+
+        template <UnitInterval INTERVAL>
+        double dnext()
+        {
+            return unit_double<INTERVAL>(next());
+        }
+
+        template <UnitInterval INTERVAL>
+        FourDoubleValues dnext4()
+        {
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                __m256d values = unit_doubles4<INTERVAL>(next4().result_packed_);
+
+                return values;
+            }
+            else
+            {
+                static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for dnext4()");
+
+                ensure_lanes_initialized();
+
+                __m256d values;
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    values[i] = unit_double<INTERVAL>(next_internal(serial_lanes_state_[i]));
+                }
+
+                return values;
+            }
+        }
+
+        //
+        //  Eight uint32s or floats at a time from a single four wide step
+        //
+        //  Each 64 bit lane of next4() is split into its 32 bit halves - value 2i is the low half of lane i and value
+        //      2i + 1 the high half, the little endian uint32 view of the four uint64s.  The bounded values reduce
+        //      each half with the multiply and shift of next(lower, upper).  The floats take the upper 23 bits of each
+        //      half as the mantissa of a float in [1,2) and subtract one, the float counterpart of dnext4().  The
+        //      lowest bits of xoshiro256+ are its weakest and show up in the low bits of the low halves returned by
+        //      next8_u32(), the bounded values and the floats depend on the upper bits of each half.
+        //
+
+        EightUInt32Values next8_u32() { return next4().result_packed_; }
+
+        EightUInt32Values next8_u32(uint32_t lower_bound, uint32_t upper_bound)
+        {
+            assert(upper_bound > lower_bound);
+
+            const uint32_t range = upper_bound - lower_bound;
+            const __m256i four_ints = next4().result_packed_;
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                const __m256i ranges = _mm256_set1_epi64x(range);
+
+                const __m256i low_halves = _mm256_srli_epi64(_mm256_mul_epu32(four_ints, ranges), 32);
+                const __m256i high_halves = _mm256_and_si256(
+                    _mm256_mul_epu32(_mm256_srli_epi64(four_ints, 32), ranges), _mm256_set1_epi64x(HIGH_HALF_MASK));
+
+                return _mm256_add_epi32(_mm256_or_si256(low_halves, high_halves), _mm256_set1_epi32(lower_bound));
+            }
+            else
+            {
+                __v8su halves = (__v8su)four_ints;
+
+                for (size_t i = 0; i < 8; i++)
+                {
+                    halves[i] = (uint32_t)(((uint64_t)halves[i] * range) >> 32) + lower_bound;
+                }
+
+                return (__m256i)halves;
+            }
+        }
+
+        EightFloatValues fnext8()
+        {
+            const __m256i four_ints = next4().result_packed_;
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return _mm256_sub_ps(
+                    _mm256_castsi256_ps(_mm256_or_si256(_mm256_srli_epi32(four_ints, 9), _mm256_set1_epi32(FLOAT_MASK))),
+                    _mm256_set1_ps(1.0f));
+            }
+            else
+            {
+                const __v8su halves = (__v8su)four_ints;
+
+                __m256 result;
+
+                for (size_t i = 0; i < 8; i++)
+                {
+                    result[i] = unit_float(halves[i]);
+                }
+
+                return result;
+            }
+        }
+
+        EightFloatValues fnext8(float lower_bound, float upper_bound)
+        {
+            const __m256 unit = fnext8().result_packed_;
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return _mm256_add_ps(_mm256_mul_ps(unit, _mm256_set1_ps(upper_bound - lower_bound)),
+                                     _mm256_set1_ps(lower_bound));
+            }
+            else
+            {
+                __m256 result;
+
+                for (size_t i = 0; i < 8; i++)
+                {
+                    result[i] = (unit[i] * (upper_bound - lower_bound)) + lower_bound;
+                }
+
+                return result;
+            }
+        }
+
+        //
+        //  Normal (Gaussian) doubles with the Ziggurat method
+        //
+        //  Each 64 bit draw gives a signed uniform u from the 52 mantissa bits and a layer from bits 4 to 11 - the
+        //      lowest bits of xoshiro256+ are its weakest, so they are skipped.  The candidate u * X[layer] is
+        //      accepted without further work about 99% of the time.  The AVX2 path gathers the table entries for all
+        //      four lanes and tests them together, lanes which land in a wedge or the tail fall back to scalar code
+        //      shared with the serial path, so serial and AVX2 instances give identical values.  The slow path draws
+        //      whole four wide steps from next4() and only the lanes which need them use the values, so every lane
+        //      keeps advancing in lockstep.
+        //
+
+        double normal(double mean = 0.0, double stddev = 1.0)
+        {
+            while (true)
+            {
+                const uint64_t draw = next();
+                const size_t layer = ziggurat_layer(draw);
+                const double u = ziggurat_signed_unit(draw);
+                const double x = u * NormalZiggurat::X[layer];
+
+                if (std::abs(u) < NormalZiggurat::RATIO[layer])
+                {
+                    return (x * stddev) + mean;
+                }
+
+                if (layer == 0)
+                {
+                    double tail_x;
+
+                    //  Named draws, the order of evaluation of function arguments is unspecified
+
+                    while (true)
+                    {
+                        const uint64_t first_draw = next();
+                        const uint64_t second_draw = next();
+
+                        if (ziggurat_tail_accepts(first_draw, second_draw, tail_x))
+                        {
+                            break;
+                        }
+                    }
+
+                    return ((x < 0 ? -tail_x : tail_x) * stddev) + mean;
+                }
+
+                if (ziggurat_wedge_accepts(layer, x, next()))
+                {
+                    return (x * stddev) + mean;
+                }
+            }
+        }
+
+        FourDoubleValues normal4(double mean = 0.0, double stddev = 1.0)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for normal4()");
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                const __m256i draws = next4();
+                const __m256i layers = _mm256_and_si256(_mm256_srli_epi64(draws, 4), _mm256_set1_epi64x(0xFF));
+
+                const __m256d unit =
+                    _mm256_castsi256_pd(_mm256_or_si256(DOUBLE_MASK_PACKED, _mm256_srli_epi64(draws, 12)));
+                const __m256d u = _mm256_sub_pd(_mm256_add_pd(unit, unit), _mm256_set1_pd(3.0));
+
+                __m256d x = _mm256_mul_pd(u, _mm256_i64gather_pd(NormalZiggurat::X.data(), layers, 8));
+
+                const int accepted = _mm256_movemask_pd(
+                    _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), u),
+                                  _mm256_i64gather_pd(NormalZiggurat::RATIO.data(), layers, 8), _CMP_LT_OQ));
+
+                if (__builtin_expect(accepted != 0xF, 0))
+                {
+                    alignas(32) double values[4];
+                    alignas(32) uint64_t lane_layers[4];
+
+                    _mm256_store_pd(values, x);
+                    _mm256_store_si256((__m256i*)lane_layers, layers);
+
+                    normal4_slow_path(values, lane_layers, accepted);
+
+                    x = _mm256_load_pd(values);
+                }
+
+                return _mm256_add_pd(_mm256_mul_pd(x, _mm256_set1_pd(stddev)), _mm256_set1_pd(mean));
+            }
+            else
+            {
+                const auto draws = next4();
+
+                double values[4];
+                uint64_t lane_layers[4];
+                int accepted = 0;
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    lane_layers[i] = ziggurat_layer(draws[i]);
+
+                    const double u = ziggurat_signed_unit(draws[i]);
+
+                    values[i] = u * NormalZiggurat::X[lane_layers[i]];
+                    accepted |= (std::abs(u) < NormalZiggurat::RATIO[lane_layers[i]]) << i;
+                }
+
+                if (__builtin_expect(accepted != 0xF, 0))
+                {
+                    normal4_slow_path(values, lane_layers, accepted);
+                }
+
+                __m256d packed_result;
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    packed_result[i] = (values[i] * stddev) + mean;
+                }
+
+                return packed_result;
+            }
+        }
+
+        //  Fills the buffer with exactly the values successive calls to normal4() would return, any unused lanes of
+        //      the final step are discarded.
+
+        void fill_normal(double* buffer, size_t count, double mean = 0.0, double stddev = 1.0)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for fill_normal()");
+
+            fill_doubles(buffer, count, [this, mean, stddev]() { return normal4(mean, stddev).result_packed_; });
+        }
+
+        //
+        //  Exponential and geometric values
+        //
+        //  Both transform a uniform U in (0,1], taken as 1 - dnext(), with a logarithm.  The log is a polynomial
+        //      evaluated with the same sequence of operations on every path - the AVX2 version four lanes at a time,
+        //      the serial version one lane at a time - so serial and AVX2 instances give identical values.  It is
+        //      accurate to within one ULP of std::log.
+        //
+        //  exponential(lambda) has rate lambda and mean 1 / lambda, as std::exponential_distribution.  geometric(p) is
+        //      the number of failures before the first success of trials with success probability p in (0,1], as
+        //      std::geometric_distribution, and is clamped to 2^52 - 1 for extremely small p.
+        //
+
+        double exponential(double lambda)
+        {
+            assert(lambda > 0);
+
+            return (0.0 - log_internal(1.0 - dnext())) * (1.0 / lambda);
+        }
+
+        FourDoubleValues exponential4(double lambda)
+        {
+            assert(lambda > 0);
+
+            const double scale = 1.0 / lambda;
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                const __m256d log_u = log4_internal(_mm256_sub_pd(ONE_PACKED_DOUBLE, dnext4()));
+
+                return _mm256_mul_pd(_mm256_sub_pd(_mm256_setzero_pd(), log_u), _mm256_set1_pd(scale));
+            }
+            else
+            {
+                auto four_doubles = dnext4();
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    four_doubles.result_packed_[i] = (0.0 - log_internal(1.0 - four_doubles[i])) * scale;
+                }
+
+                return four_doubles;
+            }
+        }
+
+        uint64_t geometric(double p)
+        {
+            assert((p > 0) && (p <= 1));
+
+            return geometric_count(log_internal(1.0 - dnext()) * (1.0 / std::log1p(-p)));
+        }
+
+        FourIntegerValues geometric4(double p)
+        {
+            assert((p > 0) && (p <= 1));
+
+            const double scale = 1.0 / std::log1p(-p);
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                const __m256d log_u = log4_internal(_mm256_sub_pd(ONE_PACKED_DOUBLE, dnext4()));
+
+                return geometric_count4(_mm256_mul_pd(log_u, _mm256_set1_pd(scale)));
+            }
+            else
+            {
+                auto four_doubles = dnext4();
+
+                return FourIntegerValues(geometric_count(log_internal(1.0 - four_doubles[0]) * scale),
+                                         geometric_count(log_internal(1.0 - four_doubles[1]) * scale),
+                                         geometric_count(log_internal(1.0 - four_doubles[2]) * scale),
+                                         geometric_count(log_internal(1.0 - four_doubles[3]) * scale));
+            }
+        }
+
+        //  The fills write exactly the values successive exponential4() or geometric4() calls would return.
+
+        void fill_exponential(double* buffer, size_t count, double lambda)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for fill_exponential()");
+
+            fill_doubles(buffer, count, [this, lambda]() { return exponential4(lambda).result_packed_; });
+        }
+
+        void fill_geometric(uint64_t* buffer, size_t count, double p)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for fill_geometric()");
+
+            fill_integers(buffer, count, [this, p]() { return geometric4(p).result_packed_; });
+        }
+
+        //
+        //  Poisson and binomial counts
+        //
+        //  Means below 10 are drawn by inversion of dnext4() - the cumulative probabilities are generated once per
+        //      call and each lane counts those at or below its uniform, so the four lanes walk the distribution
+        //      together.  Larger means use Hormann's transformed rejection, PTRS for Poisson and BTRS for binomial.
+        //      The AVX2 path computes the candidates and the cheap acceptance test for all four lanes at once, lanes
+        //      which fail it drop to scalar code shared with the serial path, which applies the full test and redraws
+        //      only the rejected lanes from further four wide draws.  Serial and AVX2 instances give identical counts.
+        //
+        //  Binomial draws with p > 0.5 are made for 1 - p and flipped, so the mean which selects the method is
+        //      n * min(p, 1 - p).  Bulk fills set up the sampler once and write the values successive four wide calls
+        //      would return.
+        //
+
+        FourIntegerValues poisson4(double mean) { return counts4(poisson_sampler(mean)); }
+
+        FourIntegerValues binomial4(uint64_t n, double p) { return counts4(binomial_sampler(n, p)); }
+
+        void fill_poisson(uint64_t* buffer, size_t count, double mean)
+        {
+            fill_counts(buffer, count, poisson_sampler(mean));
+        }
+
+        void fill_binomial(uint64_t* buffer, size_t count, uint64_t n, double p)
+        {
+            fill_counts(buffer, count, binomial_sampler(n, p));
+        }
+
+        //
+        //  Gamma and beta values
+        //
+        //  gamma4(shape, scale) uses Marsaglia and Tsang's method on normal4() and dnext4() - for shape >= 1 about
+        //      98% of the candidates pass the cheap squeeze test, which the AVX2 path applies to all four lanes at
+        //      once.  Lanes which fail it drop to scalar code shared with the serial path, which applies the full log
+        //      test and redraws only the rejected lanes.  Shapes below 1 draw for shape + 1 and scale by U^(1/shape).
+        //      beta4(a, b) is X / (X + Y) for X = gamma4(a, 1) and Y = gamma4(b, 1).  Serial and AVX2 instances give
+        //      identical values and the fills write the values successive four wide calls would return.
+        //
+
+        FourDoubleValues gamma4(double shape, double scale = 1.0)
+        {
+            __m256d values = gamma4_internal(GammaSampler(shape, scale));
+
+            return values;
+        }
+
+        FourDoubleValues beta4(double a, double b)
+        {
+            __m256d values = beta4_internal(GammaSampler(a, 1.0), GammaSampler(b, 1.0));
+
+            return values;
+        }
+
+        void fill_gamma(double* buffer, size_t count, double shape, double scale = 1.0)
+        {
+            const GammaSampler sampler(shape, scale);
+
+            fill_doubles(buffer, count, [this, &sampler]() { return gamma4_internal(sampler); });
+        }
+
+        void fill_beta(double* buffer, size_t count, double a, double b)
+        {
+            const GammaSampler a_sampler(a, 1.0);
+            const GammaSampler b_sampler(b, 1.0);
+
+            fill_doubles(buffer, count, [this, &a_sampler, &b_sampler]() { return beta4_internal(a_sampler, b_sampler); });
+        }
+
+        //
+        //  Eight or sixteen uint64s or doubles at a time - same bounding as four at a time
+        //
+        //  Requires an RNG with at least as many lanes as values.  The lanes are shared, next4() uses the first four,
+        //      next8() the first eight and next16() all sixteen.  AVX512 instances step eight lanes per register while
+        //      AVX2 instances step four-wide blocks.  All of the blocks are stepped together so the independent
+        //      dependency chains interleave and keep the SIMD ports busy.  With AVX2, next8() is the sweet spot -
+        //      the state for sixteen lanes fills all sixteen ymm registers and spills in a tight loop.
+        //
+
+        EightIntegerValues next8()
+        {
+            static_assert(LANES >= 8, "next8() requires an RNG with at least eight lanes");
+
+            return next_wide<8>();
+        }
+
+        EightIntegerValues next8(uint32_t lower_bound, uint32_t upper_bound)
+        {
+            static_assert(LANES >= 8, "next8() requires an RNG with at least eight lanes");
+
+            return next_wide<8>(lower_bound, upper_bound);
+        }
+
+        EightDoubleValues dnext8()
+        {
+            static_assert(LANES >= 8, "dnext8() requires an RNG with at least eight lanes");
+
+            return dnext_wide<8>();
+        }
+
+        EightDoubleValues dnext8(double lower_bound, double upper_bound)
+        {
+            static_assert(LANES >= 8, "dnext8() requires an RNG with at least eight lanes");
+
+            return dnext_wide<8>(lower_bound, upper_bound);
+        }
+
+        SixteenIntegerValues next16()
+        {
+            static_assert(LANES >= 16, "next16() requires an RNG with sixteen lanes");
+
+            return next_wide<16>();
+        }
+
+        SixteenIntegerValues next16(uint32_t lower_bound, uint32_t upper_bound)
+        {
+            static_assert(LANES >= 16, "next16() requires an RNG with sixteen lanes");
+
+            return next_wide<16>(lower_bound, upper_bound);
+        }
+
+        SixteenDoubleValues dnext16()
+        {
+            static_assert(LANES >= 16, "dnext16() requires an RNG with sixteen lanes");
+
+            return dnext_wide<16>();
+        }
+
+        SixteenDoubleValues dnext16(double lower_bound, double upper_bound)
+        {
+            static_assert(LANES >= 16, "dnext16() requires an RNG with sixteen lanes");
+
+            return dnext_wide<16>(lower_bound, upper_bound);
+        }
+
+        //
+        //  Bulk fills
+        //
+        //  Values are written in exactly the order successive calls to next4() or dnext4() would return them, so the
+        //      serial and AVX2 implementations fill identical buffers.  If the count is not a multiple of four, the
+        //      unused lanes of the final four wide step are discarded.  The state is held in registers for the whole
+        //      loop and only written back to the instance once the buffer is full.
+        //
+
+        void fill(uint64_t* buffer, size_t count)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for fill()");
+
+            ensure_lanes_initialized();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                SIMDBlock state(simd_state_[0]);
+
+                size_t i = 0;
+
+                if ((reinterpret_cast<uintptr_t>(buffer) & 31) == 0)
+                {
+                    for (; i + 4 <= count; i += 4)
+                    {
+                        _mm256_store_si256((__m256i*)(buffer + i), simd_next4_internal(state));
+                    }
+                }
+                else
+                {
+                    for (; i + 4 <= count; i += 4)
+                    {
+                        _mm256_storeu_si256((__m256i*)(buffer + i), simd_next4_internal(state));
+                    }
+                }
+
+                if (i < count)
+                {
+                    _mm256_maskstore_epi64((long long*)(buffer + i), tail_mask(count - i), simd_next4_internal(state));
+                }
+
+                simd_state_[0] = state;
+            }
+            else
+            {
+                std::array<SerialState, LANES> state(serial_lanes_state_);
+
+                size_t i = 0;
+
+                for (; i + 4 <= count; i += 4)
+                {
+                    buffer[i] = next_internal(state[0]);
+                    buffer[i + 1] = next_internal(state[1]);
+                    buffer[i + 2] = next_internal(state[2]);
+                    buffer[i + 3] = next_internal(state[3]);
+                }
+
+                if (i < count)
+                {
+                    const uint64_t values[4] = {next_internal(state[0]), next_internal(state[1]),
+                                                next_internal(state[2]), next_internal(state[3])};
+
+                    memcpy(buffer + i, values, (count - i) * sizeof(uint64_t));
+                }
+
+                serial_lanes_state_ = state;
+            }
+        }
+
+        void fill(double* buffer, size_t count) { fill(buffer, count, 0.0, 1.0); }
+
+        void fill(double* buffer, size_t count, double lower_bound, double upper_bound)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for fill()");
+
+            ensure_lanes_initialized();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                SIMDBlock state(simd_state_[0]);
+
+                const __m256d range = _mm256_set1_pd(upper_bound - lower_bound);
+                const __m256d lower = _mm256_set1_pd(lower_bound);
+
+                auto next_doubles = [&state, &range, &lower]() {
+                    const __m256d unit = _mm256_sub_pd(
+                        _mm256_castsi256_pd(_mm256_or_si256(DOUBLE_MASK_PACKED,
+                                                            _mm256_srli_epi64(simd_next4_internal(state), 12))),
+                        ONE_PACKED_DOUBLE);
+
+                    return _mm256_add_pd(_mm256_mul_pd(unit, range), lower);
+                };
+
+                size_t i = 0;
+
+                if ((reinterpret_cast<uintptr_t>(buffer) & 31) == 0)
+                {
+                    for (; i + 4 <= count; i += 4)
+                    {
+                        _mm256_store_pd(buffer + i, next_doubles());
+                    }
+                }
+                else
+                {
+                    for (; i + 4 <= count; i += 4)
+                    {
+                        _mm256_storeu_pd(buffer + i, next_doubles());
+                    }
+                }
+
+                if (i < count)
+                {
+                    _mm256_maskstore_pd(buffer + i, tail_mask(count - i), next_doubles());
+                }
+
+                simd_state_[0] = state;
+            }
+            else
+            {
+                union
+                {
+                    uint64_t int_value;
+                    double double_value;
+                };
+
+                std::array<SerialState, LANES> state(serial_lanes_state_);
+
+                const double range = upper_bound - lower_bound;
+
+                for (size_t i = 0; i < count; i += 4)
+                {
+                    double values[4];
+
+                    for (size_t j = 0; j < 4; j++)
+                    {
+                        int_value = (next_internal(state[j]) >> 12) | DOUBLE_MASK;
+                        values[j] = ((double_value - 1.0) * range) + lower_bound;
+                    }
+
+                    if (i + 4 <= count)
+                    {
+                        memcpy(buffer + i, values, sizeof(values));
+                    }
+                    else
+                    {
+                        memcpy(buffer + i, values, (count - i) * sizeof(double));
+                    }
+                }
+
+                serial_lanes_state_ = state;
+            }
+        }
+
+        //  Doubles in the order successive dnext4<INTERVAL>() calls return them.
+
+        template <UnitInterval INTERVAL>
+        void fill(double* buffer, size_t count)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for fill()");
+
+            ensure_lanes_initialized();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                SIMDBlock state(simd_state_[0]);
+
+                fill_doubles(buffer, count,
+                             [&state]() { return unit_doubles4<INTERVAL>(simd_next4_internal(state)); });
+
+                simd_state_[0] = state;
+            }
+            else
+            {
+                std::array<SerialState, LANES> state(serial_lanes_state_);
+
+                fill_doubles(buffer, count, [&state]() {
+                    __m256d values;
+
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        values[i] = unit_double<INTERVAL>(next_internal(state[i]));
+                    }
+
+                    return values;
+                });
+
+                serial_lanes_state_ = state;
+            }
+        }
+
+        //  uint32s and floats are written in the order successive next8_u32() or fnext8() calls return them.  The
+        //      uint32s are the little endian view of the fill(uint64_t*) stream, so they come straight from
+        //      fill_bytes() and the buffer only needs the alignment of a uint32.
+
+        void fill(uint32_t* buffer, size_t count) { fill_bytes(buffer, count * sizeof(uint32_t)); }
+
+        void fill(float* buffer, size_t count) { fill(buffer, count, 0.0f, 1.0f); }
+
+        void fill(float* buffer, size_t count, float lower_bound, float upper_bound)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for fill()");
+
+            ensure_lanes_initialized();
+
+            const float range = upper_bound - lower_bound;
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                SIMDBlock state(simd_state_[0]);
+
+                const __m256 packed_range = _mm256_set1_ps(range);
+                const __m256 lower = _mm256_set1_ps(lower_bound);
+
+                auto next_floats = [&state, &packed_range, &lower]() {
+                    const __m256 unit = _mm256_sub_ps(
+                        _mm256_castsi256_ps(_mm256_or_si256(_mm256_srli_epi32(simd_next4_internal(state), 9),
+                                                            _mm256_set1_epi32(FLOAT_MASK))),
+                        _mm256_set1_ps(1.0f));
+
+                    return _mm256_add_ps(_mm256_mul_ps(unit, packed_range), lower);
+                };
+
+                size_t i = 0;
+
+                for (; i + 8 <= count; i += 8)
+                {
+                    _mm256_storeu_ps(buffer + i, next_floats());
+                }
+
+                if (i < count)
+                {
+                    _mm256_maskstore_ps(buffer + i,
+                                        _mm256_cmpgt_epi32(_mm256_set1_epi32(count - i),
+                                                           _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)),
+                                        next_floats());
+                }
+
+                simd_state_[0] = state;
+            }
+            else
+            {
+                std::array<SerialState, LANES> state(serial_lanes_state_);
+
+                for (size_t i = 0; i < count; i += 8)
+                {
+                    float values[8];
+
+                    for (size_t j = 0; j < 4; j++)
+                    {
+                        const uint64_t value = next_internal(state[j]);
+
+                        values[2 * j] = (unit_float((uint32_t)value) * range) + lower_bound;
+                        values[(2 * j) + 1] = (unit_float((uint32_t)(value >> 32)) * range) + lower_bound;
+                    }
+
+                    memcpy(buffer + i, values, std::min(count - i, size_t(8)) * sizeof(float));
+                }
+
+                serial_lanes_state_ = state;
+            }
+        }
+
+        //  Raw bytes are the little endian bytes of the fill(uint64_t*) stream and the buffer may have any alignment.
+
+        void fill_bytes(void* buffer, size_t num_bytes)
+        {
+            uint8_t* bytes = static_cast<uint8_t*>(buffer);
+
+            const size_t num_block_bytes = num_bytes & ~size_t(31);
+
+            if ((SIMD >= SIMDInstructionSet::AVX2) || ((reinterpret_cast<uintptr_t>(bytes) & 7) == 0))
+            {
+                //  The AVX2 fill falls back to unaligned stores for a buffer which is not 32 byte aligned
+
+                fill(reinterpret_cast<uint64_t*>(bytes), num_block_bytes / sizeof(uint64_t));
+            }
+            else
+            {
+                for (size_t i = 0; i < num_block_bytes; i += 32)
+                {
+                    alignas(32) uint64_t block[4];
+
+                    fill(block, 4);
+                    memcpy(bytes + i, block, 32);
+                }
+            }
+
+            if (num_block_bytes < num_bytes)
+            {
+                alignas(32) uint64_t block[4];
+
+                fill(block, 4);
+                memcpy(bytes + num_block_bytes, block, num_bytes - num_block_bytes);
+            }
+        }
+
+        //
+        //  Packed Bernoulli bitmasks
+        //
+        //  bernoulli_fill() sets each of num_bits bits with probability p.  Bit i is bit i % 8 of byte i / 8, or bit
+        //      i % 64 of word i / 64 - the same memory on a little endian machine - and the bits past num_bits in the
+        //      last byte or word are cleared.
+        //
+        //  Rather than comparing a 64 bit uniform with p for every bit, the 256 bits of a block are compared with p
+        //      a binary digit at a time, all of them at once.  Each next4() step supplies the next digit of 256
+        //      uniforms and a bit whose digit differs from the digit of p is decided - set if the digit of p is the
+        //      one.  The block is done when no bit is left undecided or the digits of p run out.  Each digit decides
+        //      half of the remaining bits, so a block takes about nine steps for an arbitrary p - a few random bits
+        //      per output bit rather than 64 - and never more steps than p has binary digits, two for 0.25 or three
+        //      for 0.375.  p = 0.5 is decided on the first digit and comes straight from fill_bytes(), p = 1 and
+        //      p below 2^-64, which has no set digit among the first 64, draw nothing.  The serial and SIMD fills
+        //      return the same masks.
+        //
+
+        void bernoulli_fill(uint8_t* bitmask, size_t num_bits, double p)
+        {
+            assert((p >= 0) && (p <= 1));
+
+            const size_t num_bytes = (num_bits + 7) / 8;
+
+            //  The first 64 binary digits of p, zero for p below 2^-64 as well as for p = 0
+
+            const uint64_t threshold = p < 1.0 ? (uint64_t)std::ldexp(p, 64) : 0;
+
+            if ((p == 1.0) || (threshold == 0))
+            {
+                memset(bitmask, p == 1.0 ? 0xFF : 0, num_bytes);
+            }
+            else if (p == 0.5)
+            {
+                fill_bytes(bitmask, num_bytes);
+            }
+            else
+            {
+                bernoulli_fill_internal(bitmask, num_bytes, threshold);
+            }
+
+            if ((num_bits % 8) != 0)
+            {
+                bitmask[num_bytes - 1] &= (uint8_t)((1u << (num_bits % 8)) - 1);
+            }
+        }
+
+        void bernoulli_fill(uint64_t* bitmask, size_t num_bits, double p)
+        {
+            uint8_t* bytes = reinterpret_cast<uint8_t*>(bitmask);
+
+            const size_t num_bytes = (num_bits + 7) / 8;
+
+            bernoulli_fill(bytes, num_bits, p);
+
+            memset(bytes + num_bytes, 0, (((num_bits + 63) / 64) * sizeof(uint64_t)) - num_bytes);
+        }
+
+#ifdef __cpp_lib_span
+        void fill(std::span<uint64_t> buffer) { fill(buffer.data(), buffer.size()); }
+
+        void fill(std::span<double> buffer) { fill(buffer.data(), buffer.size()); }
+
+        void fill(std::span<uint32_t> buffer) { fill(buffer.data(), buffer.size()); }
+
+        void fill(std::span<float> buffer) { fill(buffer.data(), buffer.size()); }
+
+        void fill(std::span<double> buffer, double lower_bound, double upper_bound)
+        {
+            fill(buffer.data(), buffer.size(), lower_bound, upper_bound);
+        }
+#endif
+
+        //
+        //  Jump Functions
+        //
+
+        //  This is the jump function for the generator. It is equivalent
+        //     to 2^128 calls to next(); it can be used to generate 2^128
+        //     non-overlapping subsequences for parallel computations.
+
+        static std::array<uint64_t, 4> jump(const std::array<uint64_t, 4>& initial_state)
+        {
+            static const uint64_t JUMP[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa,
+                                            0x39abdc4529b1661c};
+
+            std::array<uint64_t, 4> local_state(initial_state);
+            std::array<uint64_t, 4> temp({0, 0, 0, 0});
+
+            for (int i = 0; i < sizeof JUMP / sizeof *JUMP; i++)
+            {
+                for (int b = 0; b < 64; b++)
+                {
+                    if (JUMP[i] & UINT64_C(1) << b)
+                    {
+                        temp[0] ^= local_state[0];
+                        temp[1] ^= local_state[1];
+                        temp[2] ^= local_state[2];
+                        temp[3] ^= local_state[3];
+                    }
+
+                    next_internal(local_state);
+                }
+            }
+
+            return temp;
+        }
+
+        //  This is the long-jump function for the generator. It is equivalent to
+        //      2^192 calls to next(); it can be used to generate 2^64 starting points,
+        //      from each of which jump() will generate 2^64 non-overlapping
+        //      subsequences for parallel distributed computations.
+
+        static std::array<uint64_t, 4> long_jump(const std::array<uint64_t, 4>& initial_state)
+        {
+            static const uint64_t LONG_JUMP[] = {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241,
+                                                 0x39109bb02acbe635};
+
+            std::array<uint64_t, 4> local_state(initial_state);
+            std::array<uint64_t, 4> temp({0, 0, 0, 0});
+
+            for (int i = 0; i < sizeof LONG_JUMP / sizeof *LONG_JUMP; i++)
+            {
+                for (int b = 0; b < 64; b++)
+                {
+                    if (LONG_JUMP[i] & UINT64_C(1) << b)
+                    {
+                        temp[0] ^= local_state[0];
+                        temp[1] ^= local_state[1];
+                        temp[2] ^= local_state[2];
+                        temp[3] ^= local_state[3];
+                    }
+
+                    next_internal(local_state);
+                }
+            }
+
+            return temp;
+        }
+
+        //  Applies an arbitrary jump polynomial, see Xoshiro256PlusJumpPolynomial.h.  The cost is the same 256 steps
+        //      as jump() and long_jump() whatever the distance.
+
+        static std::array<uint64_t, 4> jump(const std::array<uint64_t, 4>& initial_state,
+                                            const JumpPolynomial& polynomial)
+        {
+            std::array<uint64_t, 4> local_state(initial_state);
+            std::array<uint64_t, 4> temp({0, 0, 0, 0});
+
+            for (size_t i = 0; i < 256; i++)
+            {
+                if (polynomial.coefficient(i))
+                {
+                    temp[0] ^= local_state[0];
+                    temp[1] ^= local_state[1];
+                    temp[2] ^= local_state[2];
+                    temp[3] ^= local_state[3];
+                }
+
+                next_internal(local_state);
+            }
+
+            return temp;
+        }
+
+        //  Advances next() and every lane by distance values, the same as distance calls to next() and to the
+        //      widest next*() the instance supports, at a cost logarithmic in the distance.
+
+        void discard(__uint128_t distance) { jump_all(JumpPolynomial::for_distance(distance)); }
+
+        //  Advances the lanes alone by distance wide steps and leaves next() where it is, for callers which only
+        //      draw wide values or fill() and would otherwise pay for a jump of the serial state as well.
+
+        void discard_lanes(__uint128_t distance)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for discard_lanes()");
+
+            jump_lanes(JumpPolynomial::for_distance(distance));
+        }
+
+        //  Moves next() and every lane num_jumps jump() substreams forward from where they are now, the same as
+        //      num_jumps jump() calls on each of them.  The jump is relative: jump_streams(2) then jump_streams(3) is
+        //      jump_streams(5), and values drawn before the call stay drawn.  Only a freshly seeded RNG lands on the
+        //      start of substream k, so give each worker jump_streams(k) on its own Xoshiro256Plus(seed).
+
+        void jump_streams(uint64_t num_jumps) { jump_all(JumpPolynomial::for_jumps(num_jumps)); }
+
+       private:
+        static constexpr uint64_t DOUBLE_MASK = UINT64_C(0x3FF) << 52;
+        static constexpr uint32_t FLOAT_MASK = UINT32_C(0x7F) << 23;
+        static constexpr uint64_t HIGH_HALF_MASK = UINT64_C(0xFFFFFFFF00000000);
+
+        typedef std::array<uint64_t, 4> SerialState;
+
+        //  Stands in for state a layout leaves out.  Each member gets its own type so [[no_unique_address]] can fold
+        //      all of them away.
+
+        template <int MEMBER>
+        struct NoState
+        {
+        };
+
+        static constexpr bool HAS_SERIAL_LANES = (LAYOUT == StateLayout::Full);
+        static constexpr bool HAS_SIMD_LANES =
+            (LAYOUT != StateLayout::ScalarOnly) && (SIMD >= SIMDInstructionSet::AVX2);
+        static constexpr bool HAS_LANE_INITIALIZED_FLAG =
+            (LAYOUT != StateLayout::ScalarOnly) && (LANE_INIT == LaneInitialization::OnFirstUse);
+
+        alignas(32) SerialState serial_state_;
+
+        [[no_unique_address]] std::conditional_t<HAS_SERIAL_LANES, std::array<SerialState, LANES>, NoState<0>>
+            serial_lanes_state_ = {};
+
+        static constexpr size_t LANES_PER_SIMD_BLOCK = SIMD >= SIMDInstructionSet::AVX512 ? 8 : 4;
+
+        static inline constexpr __m256d cnstexpr_mm256_set1_pd(double value)
+        {
+            return (__m256d){value, value, value, value};
+        };
+
+        static inline constexpr __m256i cnstexpr_mm256_set1_epi64x(int64_t value)
+        {
+            return (__m256i)(__v4di){value, value, value, value};
+        };
+
+        static constexpr __m256i DOUBLE_MASK_PACKED = cnstexpr_mm256_set1_epi64x(DOUBLE_MASK);
+        static constexpr __m256i ONE_PACKED_INT64 = cnstexpr_mm256_set1_epi64x(1);
+        static constexpr __m256i ZERO_PACKED_INT64 = cnstexpr_mm256_set1_epi64x(0);
+        static constexpr __m256d ONE_PACKED_DOUBLE = cnstexpr_mm256_set1_pd(1.0);
+
+#ifdef __AVX2_AVAILABLE__
+
+        class alignas(32) SIMDState
+        {
+           public:
+            SIMDState() {}
+
+            SIMDState(const SIMDState& state_to_copy, JumpOnCopy jump_dist = JumpOnCopy::None)
+                : uint64_array_state_(state_to_copy.uint64_array_state_)
+            {
+                switch (jump_dist)
+                {
+                    case JumpOnCopy::None:
+                        break;
+
+                    case JumpOnCopy::Short:
+                        apply_jump(JumpPolynomial::for_jumps(1));
+                        break;
+
+                    case JumpOnCopy::Long:
+                        apply_jump(JumpPolynomial::for_long_jumps(1));
+                        break;
+                }
+            }
+
+            SIMDState& operator=(const SIMDState&) = default;
+
+            SIMDState(const std::array<SerialState, 4>& state) : SIMDState(state[0], state[1], state[2], state[3]) {}
+
+            SIMDState(const std::array<uint64_t, 4>& seed1, const std::array<uint64_t, 4>& seed2,
+                      const std::array<uint64_t, 4>& seed3, const std::array<uint64_t, 4>& seed4)
+            {
+                packed_state_[0][0] = seed1[0];
+                packed_state_[1][0] = seed1[1];
+                packed_state_[2][0] = seed1[2];
+                packed_state_[3][0] = seed1[3];
+
+                packed_state_[0][1] = seed2[0];
+                packed_state_[1][1] = seed2[1];
+                packed_state_[2][1] = seed2[2];
+                packed_state_[3][1] = seed2[3];
+
+                packed_state_[0][2] = seed3[0];
+                packed_state_[1][2] = seed3[1];
+                packed_state_[2][2] = seed3[2];
+                packed_state_[3][2] = seed3[3];
+
+                packed_state_[0][3] = seed4[0];
+                packed_state_[1][3] = seed4[1];
+                packed_state_[2][3] = seed4[2];
+                packed_state_[3][3] = seed4[3];
+            }
+
+            const __m256i operator[](size_t index) const { return packed_state_[index]; }
+            __m256i& operator[](size_t index) { return packed_state_[index]; }
+
+            SerialState lane(size_t index) const
+            {
+                return {uint64_array_state_[0][index], uint64_array_state_[1][index], uint64_array_state_[2][index],
+                        uint64_array_state_[3][index]};
+            }
+
+            void set_lane(size_t index, const SerialState& lane_state)
+            {
+                uint64_array_state_[0][index] = lane_state[0];
+                uint64_array_state_[1][index] = lane_state[1];
+                uint64_array_state_[2][index] = lane_state[2];
+                uint64_array_state_[3][index] = lane_state[3];
+            }
+
+            //  Jumps all four lanes at once, lane i by lane_polynomials[i].  The coefficients of each step become per
+            //      lane masks for the xor accumulation, so there are no data dependent branches in the 256 steps.
+
+            void apply_jump(const JumpPolynomial* lane_polynomials)
+            {
+                SIMDState local_state(*this);
+                __m256i temp[4] = {ZERO_PACKED_INT64, ZERO_PACKED_INT64, ZERO_PACKED_INT64, ZERO_PACKED_INT64};
+
+                for (size_t word = 0; word < 4; word++)
+                {
+                    __m256i coefficients = _mm256_set_epi64x(
+                        lane_polynomials[3].coefficients()[word], lane_polynomials[2].coefficients()[word],
+                        lane_polynomials[1].coefficients()[word], lane_polynomials[0].coefficients()[word]);
+
+                    for (size_t bit = 0; bit < 64; bit++)
+                    {
+                        const __m256i mask =
+                            _mm256_sub_epi64(ZERO_PACKED_INT64, _mm256_and_si256(coefficients, ONE_PACKED_INT64));
+
+                        temp[0] = _mm256_xor_si256(temp[0], _mm256_and_si256(local_state[0], mask));
+                        temp[1] = _mm256_xor_si256(temp[1], _mm256_and_si256(local_state[1], mask));
+                        temp[2] = _mm256_xor_si256(temp[2], _mm256_and_si256(local_state[2], mask));
+                        temp[3] = _mm256_xor_si256(temp[3], _mm256_and_si256(local_state[3], mask));
+
+                        coefficients = _mm256_srli_epi64(coefficients, 1);
+
+                        simd_next4_internal(local_state);
+                    }
+                }
+
+                packed_state_[0] = temp[0];
+                packed_state_[1] = temp[1];
+                packed_state_[2] = temp[2];
+                packed_state_[3] = temp[3];
+            }
+
+            void apply_jump(const JumpPolynomial& polynomial)
+            {
+                const JumpPolynomial lane_polynomials[4] = {polynomial, polynomial, polynomial, polynomial};
+
+                apply_jump(lane_polynomials);
+            }
+
+           private:
+            union
+            {
+                __m256i packed_state_[4];
+                std::array<std::array<uint64_t, 4>, 4> uint64_array_state_;
+            };
+        };
+
+        static FourIntegerValues simd_next4_internal(SIMDState& state)
+        {
+            FourIntegerValues result(_mm256_add_epi64(state[0], state[3]));
+
+            const __m256i temp = _mm256_slli_epi64(state[1], 17);
+
+            state[2] = _mm256_xor_si256(state[2], state[0]);
+            state[3] = _mm256_xor_si256(state[3], state[1]);
+            state[1] = _mm256_xor_si256(state[1], state[2]);
+            state[0] = _mm256_xor_si256(state[0], state[3]);
+
+            state[2] = _mm256_xor_si256(state[2], temp);
+
+            state[3] = rotl(state[3], 45);
+
+            return result;
+        }
+
+        //  Steps several blocks at once, each operation is issued for every block before moving on to the next so
+        //      the independent dependency chains are interleaved.  The loops are fully unrolled so the state stays
+        //      in registers.
+
+        template <size_t NUM_BLOCKS>
+        static void simd_next4_blocks_internal(SIMDState* state, __m256i* result)
+        {
+            __m256i temp[NUM_BLOCKS];
+
+#pragma GCC unroll 4
+            for (size_t i = 0; i < NUM_BLOCKS; i++)
+            {
+                result[i] = _mm256_add_epi64(state[i][0], state[i][3]);
+                temp[i] = _mm256_slli_epi64(state[i][1], 17);
+            }
+
+#pragma GCC unroll 4
+            for (size_t i = 0; i < NUM_BLOCKS; i++)
+            {
+                state[i][2] = _mm256_xor_si256(state[i][2], state[i][0]);
+                state[i][3] = _mm256_xor_si256(state[i][3], state[i][1]);
+            }
+
+#pragma GCC unroll 4
+            for (size_t i = 0; i < NUM_BLOCKS; i++)
+            {
+                state[i][1] = _mm256_xor_si256(state[i][1], state[i][2]);
+                state[i][0] = _mm256_xor_si256(state[i][0], state[i][3]);
+            }
+
+#pragma GCC unroll 4
+            for (size_t i = 0; i < NUM_BLOCKS; i++)
+            {
+                state[i][2] = _mm256_xor_si256(state[i][2], temp[i]);
+                state[i][3] = rotl(state[i][3], 45);
+            }
+        }
+#else
+        class SIMDState
+        {
+           public:
+            SIMDState() {}
+            SIMDState(const SIMDState& state_to_copy, JumpOnCopy jump_dist = JumpOnCopy::None) {}
+            SIMDState& operator=(const SIMDState&) = default;
+
+            SerialState lane(size_t index) const { return SerialState(); }
+            void set_lane(size_t index, const SerialState& lane_state) {}
+            void apply_jump(const JumpPolynomial* lane_polynomials) {}
+            void apply_jump(const JumpPolynomial& polynomial) {}
+        };
+
+        //  Never called, only declared so the AVX2 branches parse without AVX2 support.
+
+        template <size_t NUM_BLOCKS>
+        static void simd_next4_blocks_internal(SIMDState* state, __m256i* result);
+#endif
+
+#ifdef __AVX512_AVAILABLE__
+
+        //  Eight lanes packed into the __m512i registers, the layout mirrors SIMDState.
+
+        class alignas(64) SIMD8State
+        {
+           public:
+            SIMD8State() {}
+
+            SIMD8State(const SIMD8State& state_to_copy, JumpOnCopy jump_dist = JumpOnCopy::None)
+                : uint64_array_state_(state_to_copy.uint64_array_state_)
+            {
+                switch (jump_dist)
+                {
+                    case JumpOnCopy::None:
+                        break;
+
+                    case JumpOnCopy::Short:
+                        apply_jump(JumpPolynomial::for_jumps(1));
+                        break;
+
+                    case JumpOnCopy::Long:
+                        apply_jump(JumpPolynomial::for_long_jumps(1));
+                        break;
+                }
+            }
+
+            SIMD8State& operator=(const SIMD8State&) = default;
+
+            const __m512i operator[](size_t index) const { return packed_state_[index]; }
+            __m512i& operator[](size_t index) { return packed_state_[index]; }
+
+            SerialState lane(size_t index) const
+            {
+                return {uint64_array_state_[0][index], uint64_array_state_[1][index], uint64_array_state_[2][index],
+                        uint64_array_state_[3][index]};
+            }
+
+            void set_lane(size_t index, const SerialState& lane_state)
+            {
+                uint64_array_state_[0][index] = lane_state[0];
+                uint64_array_state_[1][index] = lane_state[1];
+                uint64_array_state_[2][index] = lane_state[2];
+                uint64_array_state_[3][index] = lane_state[3];
+            }
+
+            //  The AVX512 jump uses the coefficient bits directly as the write mask of the xor accumulation.
+
+            void apply_jump(const JumpPolynomial* lane_polynomials)
+            {
+                SIMD8State local_state(*this);
+                __m512i temp[4] = {_mm512_setzero_si512(), _mm512_setzero_si512(), _mm512_setzero_si512(),
+                                   _mm512_setzero_si512()};
+                __m512i unused;
+
+                for (size_t word = 0; word < 4; word++)
+                {
+                    __m512i coefficients = _mm512_set_epi64(
+                        lane_polynomials[7].coefficients()[word], lane_polynomials[6].coefficients()[word],
+                        lane_polynomials[5].coefficients()[word], lane_polynomials[4].coefficients()[word],
+                        lane_polynomials[3].coefficients()[word], lane_polynomials[2].coefficients()[word],
+                        lane_polynomials[1].coefficients()[word], lane_polynomials[0].coefficients()[word]);
+
+                    for (size_t bit = 0; bit < 64; bit++)
+                    {
+                        const __mmask8 mask = _mm512_test_epi64_mask(coefficients, _mm512_set1_epi64(1));
+
+                        temp[0] = _mm512_mask_xor_epi64(temp[0], mask, temp[0], local_state[0]);
+                        temp[1] = _mm512_mask_xor_epi64(temp[1], mask, temp[1], local_state[1]);
+                        temp[2] = _mm512_mask_xor_epi64(temp[2], mask, temp[2], local_state[2]);
+                        temp[3] = _mm512_mask_xor_epi64(temp[3], mask, temp[3], local_state[3]);
+
+                        coefficients = _mm512_srli_epi64(coefficients, 1);
+
+                        simd_next8_blocks_internal<1>(&local_state, &unused);
+                    }
+                }
+
+                packed_state_[0] = temp[0];
+                packed_state_[1] = temp[1];
+                packed_state_[2] = temp[2];
+                packed_state_[3] = temp[3];
+            }
+
+            void apply_jump(const JumpPolynomial& polynomial)
+            {
+                const JumpPolynomial lane_polynomials[8] = {polynomial, polynomial, polynomial, polynomial,
+                                                            polynomial, polynomial, polynomial, polynomial};
+
+                apply_jump(lane_polynomials);
+            }
+
+           private:
+            union
+            {
+                __m512i packed_state_[4];
+                std::array<std::array<uint64_t, 8>, 4> uint64_array_state_;
+            };
+        };
+
+        //  Steps several blocks at once, interleaved in the same way as simd_next4_blocks_internal().
+
+        template <size_t NUM_BLOCKS>
+        static void simd_next8_blocks_internal(SIMD8State* state, __m512i* result)
+        {
+            __m512i temp[NUM_BLOCKS];
+
+#pragma GCC unroll 4
+            for (size_t i = 0; i < NUM_BLOCKS; i++)
+            {
+                result[i] = _mm512_add_epi64(state[i][0], state[i][3]);
+                temp[i] = _mm512_slli_epi64(state[i][1], 17);
+            }
+
+#pragma GCC unroll 4
+            for (size_t i = 0; i < NUM_BLOCKS; i++)
+            {
+                state[i][2] = _mm512_xor_si512(state[i][2], state[i][0]);
+                state[i][3] = _mm512_xor_si512(state[i][3], state[i][1]);
+            }
+
+#pragma GCC unroll 4
+            for (size_t i = 0; i < NUM_BLOCKS; i++)
+            {
+                state[i][1] = _mm512_xor_si512(state[i][1], state[i][2]);
+                state[i][0] = _mm512_xor_si512(state[i][0], state[i][3]);
+            }
+
+#pragma GCC unroll 4
+            for (size_t i = 0; i < NUM_BLOCKS; i++)
+            {
+                state[i][2] = _mm512_xor_si512(state[i][2], temp[i]);
+                state[i][3] = _mm512_rol_epi64(state[i][3], 45);
+            }
+        }
+
+        //  next4() on an AVX512 instance steps only the lower four lanes, using a write mask to leave the upper
+        //      four lanes untouched for next8().
+
+        static FourIntegerValues simd_next4_internal(SIMD8State& state)
+        {
+            constexpr __mmask8 LOWER_FOUR_LANES = 0x0F;
+
+            FourIntegerValues result(_mm512_castsi512_si256(_mm512_add_epi64(state[0], state[3])));
+
+            const __m512i temp = _mm512_slli_epi64(state[1], 17);
+
+            state[2] = _mm512_mask_xor_epi64(state[2], LOWER_FOUR_LANES, state[2], state[0]);
+            state[3] = _mm512_mask_xor_epi64(state[3], LOWER_FOUR_LANES, state[3], state[1]);
+            state[1] = _mm512_mask_xor_epi64(state[1], LOWER_FOUR_LANES, state[1], state[2]);
+            state[0] = _mm512_mask_xor_epi64(state[0], LOWER_FOUR_LANES, state[0], state[3]);
+
+            state[2] = _mm512_mask_xor_epi64(state[2], LOWER_FOUR_LANES, state[2], temp);
+
+            state[3] = _mm512_mask_rol_epi64(state[3], LOWER_FOUR_LANES, state[3], 45);
+
+            return result;
+        }
+#else
+        typedef SIMDState SIMD8State;
+
+        //  Never called, only declared so the AVX512 branches parse without AVX512 support.
+
+        template <size_t NUM_BLOCKS>
+        static void simd_next8_blocks_internal(SIMD8State* state, __m512i* result);
+#endif
+
+        typedef std::conditional_t<(SIMD >= SIMDInstructionSet::AVX512), SIMD8State, SIMDState> SIMDBlock;
+
+        [[no_unique_address]] std::conditional_t<HAS_SIMD_LANES, std::array<SIMDBlock, LANES / LANES_PER_SIMD_BLOCK>,
+                                                 NoState<1>> simd_state_;
+
+        [[no_unique_address]] std::conditional_t<HAS_LANE_INITIALIZED_FLAG, bool, NoState<2>> lanes_initialized_ = {};
+
+        //
+        //  Wide value implementations shared by next8() and next16()
+        //
+
+        template <size_t NUM_VALUES>
+        WideIntegerValues<NUM_VALUES> next_wide()
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for wide values");
+
+            WideIntegerValues<NUM_VALUES> result;
+
+            ensure_lanes_initialized();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX512)
+            {
+                simd_next8_blocks_internal<NUM_VALUES / 8>(simd_state_.data(), result.result_packed8_);
+            }
+            else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                simd_next4_blocks_internal<NUM_VALUES / 4>(simd_state_.data(), result.result_packed4_);
+            }
+            else
+            {
+                for (size_t i = 0; i < NUM_VALUES; i++)
+                {
+                    result.result_packed4_[i / 4][i % 4] = next_internal(serial_lanes_state_[i]);
+                }
+            }
+
+            return result;
+        }
+
+        template <size_t NUM_VALUES>
+        WideIntegerValues<NUM_VALUES> next_wide(uint32_t lower_bound, uint32_t upper_bound)
+        {
+            assert(upper_bound > lower_bound);
+
+            uint64_t range = upper_bound - lower_bound;
+
+            auto result = next_wide<NUM_VALUES>();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX512)
+            {
+                for (size_t i = 0; i < NUM_VALUES / 8; i++)
+                {
+                    result.result_packed8_[i] = _mm512_add_epi64(
+                        _mm512_srli_epi64(_mm512_mul_epu32(result.result_packed8_[i], _mm512_set1_epi64(range)), 32),
+                        _mm512_set1_epi64(lower_bound));
+                }
+            }
+            else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                for (size_t i = 0; i < NUM_VALUES / 4; i++)
+                {
+                    result.result_packed4_[i] = _mm256_add_epi64(
+                        _mm256_srli_epi64(_mm256_mul_epu32(result.result_packed4_[i], _mm256_set1_epi64x(range)), 32),
+                        _mm256_set1_epi64x(lower_bound));
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < NUM_VALUES; i++)
+                {
+                    result.result_packed4_[i / 4][i % 4] =
+                        (((uint64_t)((uint32_t)result[i]) * range) >> 32) + (uint64_t)lower_bound;
+                }
+            }
+
+            return result;
+        }
+
+        template <size_t NUM_VALUES>
+        WideDoubleValues<NUM_VALUES> dnext_wide()
+        {
+            auto next_ints = next_wide<NUM_VALUES>();
+
+            WideDoubleValues<NUM_VALUES> result;
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX512)
+            {
+                for (size_t i = 0; i < NUM_VALUES / 8; i++)
+                {
+                    result.result_packed8_[i] = _mm512_sub_pd(
+                        _mm512_castsi512_pd(_mm512_or_si512(_mm512_set1_epi64(DOUBLE_MASK),
+                                                            _mm512_srli_epi64(next_ints.result_packed8_[i], 12))),
+                        _mm512_set1_pd(1.0));
+                }
+            }
+            else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                for (size_t i = 0; i < NUM_VALUES / 4; i++)
+                {
+                    result.result_packed4_[i] = _mm256_sub_pd(
+                        _mm256_castsi256_pd(
+                            _mm256_or_si256(DOUBLE_MASK_PACKED, _mm256_srli_epi64(next_ints.result_packed4_[i], 12))),
+                        ONE_PACKED_DOUBLE);
+                }
+            }
+            else
+            {
+                union
+                {
+                    uint64_t int_value;
+                    double double_value;
+                };
+
+                for (size_t i = 0; i < NUM_VALUES; i++)
+                {
+                    int_value = (next_ints[i] >> 12) | DOUBLE_MASK;
+                    result.result_packed4_[i / 4][i % 4] = double_value - 1.0;
+                }
+            }
+
+            return result;
+        }
+
+        template <size_t NUM_VALUES>
+        WideDoubleValues<NUM_VALUES> dnext_wide(double lower_bound, double upper_bound)
+        {
+            const double range = upper_bound - lower_bound;
+
+            auto result = dnext_wide<NUM_VALUES>();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX512)
+            {
+                for (size_t i = 0; i < NUM_VALUES / 8; i++)
+                {
+                    result.result_packed8_[i] = _mm512_add_pd(
+                        _mm512_mul_pd(result.result_packed8_[i], _mm512_set1_pd(range)), _mm512_set1_pd(lower_bound));
+                }
+            }
+            else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                for (size_t i = 0; i < NUM_VALUES / 4; i++)
+                {
+                    result.result_packed4_[i] = _mm256_add_pd(
+                        _mm256_mul_pd(result.result_packed4_[i], _mm256_set1_pd(range)), _mm256_set1_pd(lower_bound));
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < NUM_VALUES; i++)
+                {
+                    result.result_packed4_[i / 4][i % 4] = (result[i] * range) + lower_bound;
+                }
+            }
+
+            return result;
+        }
+
+        //
+        //  Until the lanes are derived their seed is parked in the storage for the first lane.  Deferred instances
+        //      park it in every lane, so copying them before the first wide call never reads indeterminate state.
+        //
+
+        void seed_lanes()
+        {
+            if constexpr (LAYOUT != StateLayout::ScalarOnly)
+            {
+                if constexpr (LANE_INIT == LaneInitialization::OnConstruction)
+                {
+                    set_lane_seed(serial_state_);
+                    initialize_lanes();
+                }
+                else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+                {
+                    for (auto& block_state : simd_state_)
+                    {
+                        for (size_t i = 0; i < LANES_PER_SIMD_BLOCK; i++)
+                        {
+                            block_state.set_lane(i, serial_state_);
+                        }
+                    }
+                }
+                else
+                {
+                    serial_lanes_state_.fill(serial_state_);
+                }
+            }
+        }
+
+        SerialState lane_seed() const
+        {
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return simd_state_[0].lane(0);
+            }
+            else
+            {
+                return serial_lanes_state_[0];
+            }
+        }
+
+        void set_lane_seed(const SerialState& seed)
+        {
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                simd_state_[0].set_lane(0, seed);
+            }
+            else
+            {
+                serial_lanes_state_[0] = seed;
+            }
+        }
+
+        bool lanes_deferred() const
+        {
+            if constexpr (HAS_LANE_INITIALIZED_FLAG)
+            {
+                return !lanes_initialized_;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        void ensure_lanes_initialized()
+        {
+            if constexpr (LANE_INIT == LaneInitialization::OnFirstUse)
+            {
+                if (__builtin_expect(lanes_deferred(), 0))
+                {
+                    initialize_lanes();
+                }
+            }
+        }
+
+        //  Lane i is i + 1 long jumps from the seed.  The SIMD instances start every lane of a block at the seed and
+        //      jump each by its own multiple of the long jump, so a whole block costs a single jump instead of a
+        //      chain of long jumps.  Kept out of line so the deferred initialization check stays small.
+
+        __attribute__((noinline, cold)) void initialize_lanes()
+        {
+            const SerialState seed = lane_seed();
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                const std::array<JumpPolynomial, LANES>& lane_polynomials = long_jump_lane_polynomials();
+
+                for (size_t block = 0; block < simd_state_.size(); block++)
+                {
+                    for (size_t i = 0; i < LANES_PER_SIMD_BLOCK; i++)
+                    {
+                        simd_state_[block].set_lane(i, seed);
+                    }
+
+                    simd_state_[block].apply_jump(lane_polynomials.data() + (block * LANES_PER_SIMD_BLOCK));
+                }
+            }
+            else
+            {
+                serial_lanes_state_[0] = long_jump(seed);
+
+                for (size_t i = 1; i < LANES; i++)
+                {
+                    serial_lanes_state_[i] = long_jump(serial_lanes_state_[i - 1]);
+                }
+            }
+
+            if constexpr (HAS_LANE_INITIALIZED_FLAG)
+            {
+                lanes_initialized_ = true;
+            }
+        }
+
+        static const std::array<JumpPolynomial, LANES>& long_jump_lane_polynomials()
+        {
+            static const std::array<JumpPolynomial, LANES> LANE_POLYNOMIALS = []() {
+                std::array<JumpPolynomial, LANES> polynomials;
+
+                for (size_t i = 0; i < LANES; i++)
+                {
+                    polynomials[i] = JumpPolynomial::for_long_jumps(i + 1);
+                }
+
+                return polynomials;
+            }();
+
+            return LANE_POLYNOMIALS;
+        }
+
+        //  The serial lanes are only stepped by NONE instances, the SIMD blocks hold the lanes otherwise.
+
+        void jump_all(const JumpPolynomial& polynomial)
+        {
+            serial_state_ = jump(serial_state_, polynomial);
+
+            jump_lanes(polynomial);
+        }
+
+        void jump_lanes(const JumpPolynomial& polynomial)
+        {
+            if constexpr (LAYOUT == StateLayout::ScalarOnly)
+            {
+                return;
+            }
+            else if (lanes_deferred())
+            {
+                set_lane_seed(jump(lane_seed(), polynomial));
+            }
+            else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                for (auto& block_state : simd_state_)
+                {
+                    block_state.apply_jump(polynomial);
+                }
+            }
+            else
+            {
+                for (auto& lane_state : serial_lanes_state_)
+                {
+                    lane_state = jump(lane_state, polynomial);
+                }
+            }
+        }
+
+        static uint64_t next_internal(SerialState& state)
+        {
+            const uint64_t result = state[0] + state[3];
+
+            const uint64_t t = state[1] << 17;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+
+            state[2] ^= t;
+
+            state[3] = rotl(state[3], 45);
+
+            return result;
+        }
+
+        static inline uint64_t rotl(const uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+        static inline __m256i rotl(const __m256i x, int k)
+        {
+            return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+        }
+
+        //  Shared by the unbiased four wide calls.  The rejection check against the range is cheap, lane_thresholds
+        //      computes the 2^32 mod range thresholds with a division per distinct range and is only called when some
+        //      lane fails that check.
+
+        template <typename LANE_THRESHOLDS>
+        FourIntegerValues next4_unbiased_internal(const __m256i lower_bounds, const __m256i ranges,
+                                                  LANE_THRESHOLDS lane_thresholds)
+        {
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                const __m256i low_bits_mask = _mm256_set1_epi64x(0xFFFFFFFF);
+
+                __m256i product = _mm256_mul_epu32(next4(), ranges);
+                __m256i rejected = _mm256_cmpgt_epi64(ranges, _mm256_and_si256(product, low_bits_mask));
+
+                if (__builtin_expect(!_mm256_testz_si256(rejected, rejected), 0))
+                {
+                    const __m256i thresholds = lane_thresholds();
+
+                    rejected = _mm256_cmpgt_epi64(thresholds, _mm256_and_si256(product, low_bits_mask));
+
+                    while (!_mm256_testz_si256(rejected, rejected))
+                    {
+                        product = _mm256_blendv_epi8(product, _mm256_mul_epu32(next4(), ranges), rejected);
+                        rejected = _mm256_and_si256(
+                            rejected, _mm256_cmpgt_epi64(thresholds, _mm256_and_si256(product, low_bits_mask)));
+                    }
+                }
+
+                return _mm256_add_epi64(_mm256_srli_epi64(product, 32), lower_bounds);
+            }
+            else
+            {
+                auto four_ints = next4();
+
+                bool any_rejected = false;
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    four_ints.result_packed_[i] = (uint64_t)((uint32_t)four_ints[i]) * (uint32_t)ranges[i];
+                    any_rejected |= (uint32_t)four_ints[i] < (uint32_t)ranges[i];
+                }
+
+                if (__builtin_expect(any_rejected, 0))
+                {
+                    const __m256i thresholds = lane_thresholds();
+
+                    bool rejected[4];
+
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        rejected[i] = (uint32_t)four_ints[i] < (uint32_t)thresholds[i];
+                    }
+
+                    while (rejected[0] || rejected[1] || rejected[2] || rejected[3])
+                    {
+                        auto refill = next4();
+
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            if (rejected[i])
+                            {
+                                four_ints.result_packed_[i] = (uint64_t)((uint32_t)refill[i]) * (uint32_t)ranges[i];
+                                rejected[i] = (uint32_t)four_ints[i] < (uint32_t)thresholds[i];
+                            }
+                        }
+                    }
+                }
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    four_ints.result_packed_[i] = (four_ints[i] >> 32) + (uint64_t)(uint32_t)lower_bounds[i];
+                }
+
+                return four_ints;
+            }
+        }
+
+        //  2^32 mod range, the low product bits below this threshold come from the over represented interval.
+
+        static inline constexpr uint32_t lane_threshold(uint32_t range) { return (uint32_t)(-range) % range; }
+
+        //
+        //  Natural log shared by the serial and AVX2 paths, after the fdlibm __ieee754_log.  x = 2^k * (1 + f) with
+        //      1 + f in [sqrt(2)/2, sqrt(2)), then log(1 + f) = f - f^2/2 + s * (f^2/2 + R(s^2)) with s = f / (2 + f)
+        //      and R a minimax polynomial.  Only positive normal arguments are handled, which is all a uniform in
+        //      (0,1] needs.  Both versions perform exactly the same IEEE operations in the same order.
+        //
+
+        struct LogConstants
+        {
+            static constexpr double LN2_HI = 6.93147180369123816490e-01;
+            static constexpr double LN2_LO = 1.90821492927058770002e-10;
+            static constexpr double LG1 = 6.666666666666735130e-01;
+            static constexpr double LG2 = 3.999999999940941908e-01;
+            static constexpr double LG3 = 2.857142874366239149e-01;
+            static constexpr double LG4 = 2.222219843214978396e-01;
+            static constexpr double LG5 = 1.818357216161805012e-01;
+            static constexpr double LG6 = 1.531383769920937332e-01;
+            static constexpr double LG7 = 1.479819860511658591e-01;
+
+            static constexpr uint64_t MANTISSA_MASK = (UINT64_C(1) << 52) - 1;
+
+            //  Mantissa bits of sqrt(2), mantissas above it are halved so 1 + f straddles 1.
+
+            static constexpr uint64_t SQRT2_MANTISSA = UINT64_C(0x6A09E667F3BCD);
+
+            //  2^52 + 1023, the biased exponent or'ed into the mantissa of 2^52 converts exactly to a double.
+
+            static constexpr uint64_t EXPONENT_MAGIC = UINT64_C(0x4330000000000000);
+            static constexpr double EXPONENT_OFFSET = 4503599627370496.0 + 1023.0;
+        };
+
+        static inline double log_polynomial(double f, double k)
+        {
+            const double s = f / (2.0 + f);
+            const double z = s * s;
+            const double w = z * z;
+
+            const double t1 = w * (LogConstants::LG2 + (w * (LogConstants::LG4 + (w * LogConstants::LG6))));
+            const double t2 =
+                z * (LogConstants::LG1 + (w * (LogConstants::LG3 + (w * (LogConstants::LG5 + (w * LogConstants::LG7))))));
+            const double r = t2 + t1;
+            const double half_f_squared = 0.5 * f * f;
+
+            return (k * LogConstants::LN2_HI) -
+                   ((half_f_squared - ((s * (half_f_squared + r)) + (k * LogConstants::LN2_LO))) - f);
+        }
+
+        static inline double log_internal(double x)
+        {
+            union
+            {
+                uint64_t int_value;
+                double double_value;
+            };
+
+            double_value = x;
+
+            const uint64_t mantissa = int_value & LogConstants::MANTISSA_MASK;
+            const uint64_t halve = mantissa > LogConstants::SQRT2_MANTISSA ? 1 : 0;
+
+            const uint64_t biased_exponent = (int_value >> 52) + halve;
+
+            int_value = mantissa | ((1023 - halve) << 52);
+
+            const double f = double_value - 1.0;
+
+            int_value = biased_exponent | LogConstants::EXPONENT_MAGIC;
+
+            return log_polynomial(f, double_value - LogConstants::EXPONENT_OFFSET);
+        }
+
+        static inline __m256d log4_internal(__m256d x)
+        {
+            const __m256i bits = _mm256_castpd_si256(x);
+            const __m256i mantissa = _mm256_and_si256(bits, _mm256_set1_epi64x(LogConstants::MANTISSA_MASK));
+            const __m256i halve = _mm256_srli_epi64(
+                _mm256_cmpgt_epi64(mantissa, _mm256_set1_epi64x(LogConstants::SQRT2_MANTISSA)), 63);
+
+            const __m256i biased_exponent = _mm256_add_epi64(_mm256_srli_epi64(bits, 52), halve);
+
+            const __m256d f = _mm256_sub_pd(
+                _mm256_castsi256_pd(_mm256_or_si256(
+                    mantissa, _mm256_slli_epi64(_mm256_sub_epi64(_mm256_set1_epi64x(1023), halve), 52))),
+                ONE_PACKED_DOUBLE);
+
+            const __m256d k = _mm256_sub_pd(
+                _mm256_castsi256_pd(_mm256_or_si256(biased_exponent, _mm256_set1_epi64x(LogConstants::EXPONENT_MAGIC))),
+                _mm256_set1_pd(LogConstants::EXPONENT_OFFSET));
+
+            const __m256d s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+            const __m256d z = _mm256_mul_pd(s, s);
+            const __m256d w = _mm256_mul_pd(z, z);
+
+            const __m256d t1 = _mm256_mul_pd(
+                w, _mm256_add_pd(_mm256_set1_pd(LogConstants::LG2),
+                                 _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(LogConstants::LG4),
+                                                                _mm256_mul_pd(w, _mm256_set1_pd(LogConstants::LG6))))));
+            const __m256d t2 = _mm256_mul_pd(
+                z, _mm256_add_pd(
+                       _mm256_set1_pd(LogConstants::LG1),
+                       _mm256_mul_pd(
+                           w, _mm256_add_pd(_mm256_set1_pd(LogConstants::LG3),
+                                            _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(LogConstants::LG5),
+                                                                           _mm256_mul_pd(w, _mm256_set1_pd(
+                                                                                                LogConstants::LG7))))))));
+            const __m256d r = _mm256_add_pd(t2, t1);
+            const __m256d half_f_squared = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), f), f);
+
+            return _mm256_sub_pd(
+                _mm256_mul_pd(k, _mm256_set1_pd(LogConstants::LN2_HI)),
+                _mm256_sub_pd(
+                    _mm256_sub_pd(half_f_squared,
+                                  _mm256_add_pd(_mm256_mul_pd(s, _mm256_add_pd(half_f_squared, r)),
+                                                _mm256_mul_pd(k, _mm256_set1_pd(LogConstants::LN2_LO)))),
+                    f));
+        }
+
+        //  Counts are whole numbers held in doubles, clamped to 2^52 - 1 so the conversion to an integer stays exact.
+
+        static constexpr double MAX_COUNT = 4503599627370495.0;
+
+        //  Geometric counts are floor(log(U) / log(1 - p)).
+
+        static inline uint64_t geometric_count(double ratio) { return (uint64_t)std::min(std::floor(ratio), MAX_COUNT); }
+
+        static inline __m256i geometric_count4(__m256d ratio)
+        {
+            return whole_doubles_to_uint64(_mm256_min_pd(
+                _mm256_round_pd(ratio, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC), _mm256_set1_pd(MAX_COUNT)));
+        }
+
+        //  AVX2 has no double to int64 conversion, but adding 2^52 to a whole number in [0, 2^52) leaves the number
+        //      in the low mantissa bits.
+
+        static inline __m256i whole_doubles_to_uint64(__m256d values)
+        {
+            const __m256d two_to_52 = _mm256_set1_pd(4503599627370496.0);
+
+            return _mm256_xor_si256(_mm256_castpd_si256(_mm256_add_pd(values, two_to_52)),
+                                    _mm256_castpd_si256(two_to_52));
+        }
+
+        //
+        //  Poisson and binomial samplers
+        //
+        //  The parameters are computed once per four wide call or once per fill.  Inversion walks the cumulative
+        //      probabilities pmf(0), pmf(0) + pmf(1), ... with pmf(j) = pmf(j - 1) * ((pmf_scale / j) - pmf_offset).
+        //      Transformed rejection takes candidates floor(((2a / us) + b) * u + c) with u uniform in [-0.5, 0.5) and
+        //      us = 0.5 - |u|, see Hormann, 'The transformed rejection method for generating Poisson random variables'
+        //      (PTRS) and 'The generation of binomial random variates' (BTRS).
+        //
+
+        struct CountSampler
+        {
+            enum class Method
+            {
+                Inversion,
+                PoissonRejection,
+                BinomialRejection
+            };
+
+            Method method;
+
+            //  Largest count - n for binomial.  Binomial counts drawn for 1 - p are flipped to n - count.
+
+            double max_count;
+            bool flipped;
+
+            double pmf_zero;
+            double pmf_scale;
+            double pmf_offset;
+
+            double a;
+            double two_a;
+            double b;
+            double c;
+            double v_r;
+
+            //  Log acceptance constants, the mode is the Poisson mean or the binomial mode.
+
+            double log_alpha;
+            double log_ratio;
+            double mode;
+            double h;
+        };
+
+        static CountSampler poisson_sampler(double mean)
+        {
+            assert((mean >= 0) && (mean < MAX_COUNT / 2));
+
+            CountSampler sampler = {};
+
+            sampler.max_count = MAX_COUNT;
+
+            if (mean < 10)
+            {
+                sampler.method = CountSampler::Method::Inversion;
+                sampler.pmf_zero = std::exp(-mean);
+                sampler.pmf_scale = mean;
+            }
+            else
+            {
+                const double root_mean = std::sqrt(mean);
+
+                sampler.method = CountSampler::Method::PoissonRejection;
+                sampler.b = 0.931 + (2.53 * root_mean);
+                sampler.a = -0.059 + (0.02483 * sampler.b);
+                sampler.two_a = 2.0 * sampler.a;
+                sampler.c = mean + 0.43;
+                sampler.v_r = 0.9277 - (3.6224 / (sampler.b - 2));
+                sampler.log_alpha = std::log(1.1239 + (1.1328 / (sampler.b - 3.4)));
+                sampler.log_ratio = std::log(mean);
+                sampler.mode = mean;
+            }
+
+            return sampler;
+        }
+
+        static CountSampler binomial_sampler(uint64_t n, double p)
+        {
+            assert((p >= 0) && (p <= 1) && (n <= (uint64_t)MAX_COUNT));
+
+            CountSampler sampler = {};
+
+            const double trials = (double)n;
+
+            sampler.max_count = trials;
+            sampler.flipped = p > 0.5;
+
+            if (sampler.flipped)
+            {
+                p = 1.0 - p;
+            }
+
+            const double q = 1.0 - p;
+
+            if (trials * p < 10)
+            {
+                sampler.method = CountSampler::Method::Inversion;
+                sampler.pmf_zero = std::pow(q, trials);
+                sampler.pmf_offset = p / q;
+                sampler.pmf_scale = (trials + 1) * sampler.pmf_offset;
+            }
+            else
+            {
+                const double root_npq = std::sqrt(trials * p * q);
+
+                sampler.method = CountSampler::Method::BinomialRejection;
+                sampler.b = 1.15 + (2.53 * root_npq);
+                sampler.a = -0.0873 + (0.0248 * sampler.b) + (0.01 * p);
+                sampler.two_a = 2.0 * sampler.a;
+                sampler.c = (trials * p) + 0.5;
+                sampler.v_r = 0.92 - (4.2 / sampler.b);
+                sampler.log_alpha = std::log((2.83 + (5.1 / sampler.b)) * root_npq);
+                sampler.log_ratio = std::log(p / q);
+                sampler.mode = std::floor((trials + 1) * p);
+                sampler.h = std::lgamma(sampler.mode + 1) + std::lgamma(trials - sampler.mode + 1);
+            }
+
+            return sampler;
+        }
+
+        static inline void rejection_candidate(const CountSampler& sampler, double uniform_u, double uniform_v,
+                                               double& us, double& v, double& k)
+        {
+            const double u = uniform_u - 0.5;
+
+            us = 0.5 - std::abs(u);
+            v = uniform_v;
+            k = std::floor((((sampler.two_a / us) + sampler.b) * u) + sampler.c);
+        }
+
+        static inline bool rejection_fast_accepts(const CountSampler& sampler, double us, double v, double k)
+        {
+            return (us >= 0.07) && (v <= sampler.v_r) && (k >= 0) && (k <= sampler.max_count);
+        }
+
+        static inline bool rejection_accepts(const CountSampler& sampler, double us, double v, double k)
+        {
+            if ((k < 0) || (k > sampler.max_count))
+            {
+                return false;
+            }
+
+            if ((us >= 0.07) && (v <= sampler.v_r))
+            {
+                return true;
+            }
+
+            if ((sampler.method == CountSampler::Method::PoissonRejection) && (us < 0.013) && (v > us))
+            {
+                return false;
+            }
+
+            const double lhs = std::log(v) + sampler.log_alpha - std::log((sampler.a / (us * us)) + sampler.b);
+
+            if (sampler.method == CountSampler::Method::PoissonRejection)
+            {
+                return lhs <= -sampler.mode + (k * sampler.log_ratio) - std::lgamma(k + 1);
+            }
+
+            return lhs <= sampler.h - std::lgamma(k + 1) - std::lgamma(sampler.max_count - k + 1) +
+                              ((k - sampler.mode) * sampler.log_ratio);
+        }
+
+        //  Resolves the lanes of a four wide rejection step which failed the fast test, in the same way as
+        //      normal4_slow_path().  Rejected lanes take new candidates from a further pair of four wide draws.
+
+        void rejection_slow_path(const CountSampler& sampler, double (&us)[4], double (&v)[4], double (&k)[4],
+                                 int accepted)
+        {
+            for (size_t i = 0; i < 4; i++)
+            {
+                if (!(accepted & (1 << i)) && rejection_accepts(sampler, us[i], v[i], k[i]))
+                {
+                    accepted |= 1 << i;
+                }
+            }
+
+            while (accepted != 0xF)
+            {
+                const auto first_draws = dnext4();
+                const auto second_draws = dnext4();
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    if (!(accepted & (1 << i)))
+                    {
+                        rejection_candidate(sampler, first_draws[i], second_draws[i], us[i], v[i], k[i]);
+
+                        if (rejection_accepts(sampler, us[i], v[i], k[i]))
+                        {
+                            accepted |= 1 << i;
+                        }
+                    }
+                }
+            }
+        }
+
+        FourIntegerValues counts4(const CountSampler& sampler)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for poisson4() or binomial4()");
+
+            if (sampler.method == CountSampler::Method::Inversion)
+            {
+                return flip_counts(sampler, inversion_counts4(sampler));
+            }
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                const __m256d half = _mm256_set1_pd(0.5);
+
+                const __m256d u = _mm256_sub_pd(dnext4(), half);
+                const __m256d v = dnext4();
+                const __m256d us = _mm256_sub_pd(half, _mm256_andnot_pd(_mm256_set1_pd(-0.0), u));
+
+                __m256d k = _mm256_round_pd(
+                    _mm256_add_pd(_mm256_mul_pd(_mm256_add_pd(_mm256_div_pd(_mm256_set1_pd(sampler.two_a), us),
+                                                              _mm256_set1_pd(sampler.b)),
+                                                u),
+                                  _mm256_set1_pd(sampler.c)),
+                    _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+                const __m256d fast = _mm256_and_pd(
+                    _mm256_and_pd(_mm256_cmp_pd(us, _mm256_set1_pd(0.07), _CMP_GE_OQ),
+                                  _mm256_cmp_pd(v, _mm256_set1_pd(sampler.v_r), _CMP_LE_OQ)),
+                    _mm256_and_pd(_mm256_cmp_pd(k, _mm256_setzero_pd(), _CMP_GE_OQ),
+                                  _mm256_cmp_pd(k, _mm256_set1_pd(sampler.max_count), _CMP_LE_OQ)));
+
+                const int accepted = _mm256_movemask_pd(fast);
+
+                if (__builtin_expect(accepted != 0xF, 0))
+                {
+                    alignas(32) double lane_us[4];
+                    alignas(32) double lane_v[4];
+                    alignas(32) double lane_k[4];
+
+                    _mm256_store_pd(lane_us, us);
+                    _mm256_store_pd(lane_v, v);
+                    _mm256_store_pd(lane_k, k);
+
+                    rejection_slow_path(sampler, lane_us, lane_v, lane_k, accepted);
+
+                    k = _mm256_load_pd(lane_k);
+                }
+
+                return flip_counts(sampler, whole_doubles_to_uint64(k));
+            }
+            else
+            {
+                const auto first_draws = dnext4();
+                const auto second_draws = dnext4();
+
+                double us[4];
+                double v[4];
+                double k[4];
+                int accepted = 0;
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    rejection_candidate(sampler, first_draws[i], second_draws[i], us[i], v[i], k[i]);
+
+                    accepted |= rejection_fast_accepts(sampler, us[i], v[i], k[i]) << i;
+                }
+
+                if (__builtin_expect(accepted != 0xF, 0))
+                {
+                    rejection_slow_path(sampler, us, v, k, accepted);
+                }
+
+                return flip_counts(sampler, (__m256i)(__v4du){(uint64_t)k[0], (uint64_t)k[1], (uint64_t)k[2],
+                                                              (uint64_t)k[3]});
+            }
+        }
+
+        //  Every lane counts the cumulative probabilities at or below its uniform.  The cumulative probabilities are
+        //      generated once for all four lanes and the walk stops when no lane is above the last one, when the
+        //      count reaches the largest count or when the probabilities underflow.
+
+        __m256i inversion_counts4(const CountSampler& sampler)
+        {
+            const auto u = dnext4();
+
+            double pmf = sampler.pmf_zero;
+            double cdf = pmf;
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                __m256i counts = ZERO_PACKED_INT64;
+
+                for (double j = 1; j <= sampler.max_count; j++)
+                {
+                    const __m256d above = _mm256_cmp_pd(u, _mm256_set1_pd(cdf), _CMP_GE_OQ);
+
+                    if (_mm256_testz_pd(above, above))
+                    {
+                        break;
+                    }
+
+                    counts = _mm256_sub_epi64(counts, _mm256_castpd_si256(above));
+
+                    pmf *= (sampler.pmf_scale / j) - sampler.pmf_offset;
+
+                    if (pmf == 0)
+                    {
+                        break;
+                    }
+
+                    cdf += pmf;
+                }
+
+                return counts;
+            }
+            else
+            {
+                __m256i counts = ZERO_PACKED_INT64;
+
+                for (double j = 1; j <= sampler.max_count; j++)
+                {
+                    bool any_above = false;
+
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        if (u[i] >= cdf)
+                        {
+                            counts[i]++;
+                            any_above = true;
+                        }
+                    }
+
+                    if (!any_above)
+                    {
+                        break;
+                    }
+
+                    pmf *= (sampler.pmf_scale / j) - sampler.pmf_offset;
+
+                    if (pmf == 0)
+                    {
+                        break;
+                    }
+
+                    cdf += pmf;
+                }
+
+                return counts;
+            }
+        }
+
+        void fill_counts(uint64_t* buffer, size_t count, const CountSampler& sampler)
+        {
+            fill_integers(buffer, count, [this, &sampler]() { return counts4(sampler).result_packed_; });
+        }
+
+        static inline __m256i flip_counts(const CountSampler& sampler, const __m256i counts)
+        {
+            if (!sampler.flipped)
+            {
+                return counts;
+            }
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return _mm256_sub_epi64(_mm256_set1_epi64x((uint64_t)sampler.max_count), counts);
+            }
+            else
+            {
+                return cnstexpr_mm256_set1_epi64x((uint64_t)sampler.max_count) - counts;
+            }
+        }
+
+        //
+        //  Marsaglia and Tsang gamma sampler
+        //
+        //  Candidates are d * v with v = (1 + c * x)^3 for a standard normal x, d = shape - 1/3 and c = 1 / sqrt(9d).
+        //      A candidate with v > 0 is accepted if u < 1 - 0.0331 * x^4, the squeeze, or if
+        //      log(u) < x^2 / 2 + d * (1 - v + log(v)).
+        //
+
+        struct GammaSampler
+        {
+            GammaSampler(double shape, double scale) : scale(scale), boosted(shape < 1.0)
+            {
+                assert(shape > 0);
+
+                d = (boosted ? shape + 1.0 : shape) - (1.0 / 3.0);
+                c = 1.0 / std::sqrt(9.0 * d);
+                inverse_shape = 1.0 / shape;
+            }
+
+            double scale;
+            bool boosted;
+            double d;
+            double c;
+            double inverse_shape;
+        };
+
+        static inline double gamma_cube(const GammaSampler& sampler, double x)
+        {
+            const double v = 1.0 + (sampler.c * x);
+
+            return (v * v) * v;
+        }
+
+        static inline bool gamma_squeeze_accepts(double x, double u, double v)
+        {
+            const double x_squared = x * x;
+
+            return (v > 0) && (u < 1.0 - (0.0331 * (x_squared * x_squared)));
+        }
+
+        static inline bool gamma_accepts(const GammaSampler& sampler, double x, double u, double v)
+        {
+            if (v <= 0)
+            {
+                return false;
+            }
+
+            return gamma_squeeze_accepts(x, u, v) ||
+                   (std::log(u) < (0.5 * x * x) + (sampler.d * (1.0 - v + std::log(v))));
+        }
+
+        //  Resolves the lanes of a gamma4 step which failed the squeeze, in the same way as normal4_slow_path().
+
+        void gamma_slow_path(const GammaSampler& sampler, double (&v)[4], const double (&x)[4], const double (&u)[4],
+                             int accepted)
+        {
+            for (size_t i = 0; i < 4; i++)
+            {
+                if (!(accepted & (1 << i)) && gamma_accepts(sampler, x[i], u[i], v[i]))
+                {
+                    accepted |= 1 << i;
+                }
+            }
+
+            while (accepted != 0xF)
+            {
+                const auto normals = normal4();
+                const auto uniforms = dnext4();
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    if (!(accepted & (1 << i)))
+                    {
+                        v[i] = gamma_cube(sampler, normals[i]);
+
+                        if (gamma_accepts(sampler, normals[i], uniforms[i], v[i]))
+                        {
+                            accepted |= 1 << i;
+                        }
+                    }
+                }
+            }
+        }
+
+        __m256d gamma4_internal(const GammaSampler& sampler)
+        {
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for gamma4()");
+
+            alignas(32) double v[4];
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                const __m256d x = normal4();
+                const __m256d u = dnext4();
+
+                __m256d cube = _mm256_add_pd(ONE_PACKED_DOUBLE, _mm256_mul_pd(_mm256_set1_pd(sampler.c), x));
+                cube = _mm256_mul_pd(_mm256_mul_pd(cube, cube), cube);
+
+                const __m256d x_squared = _mm256_mul_pd(x, x);
+
+                const int accepted = _mm256_movemask_pd(_mm256_and_pd(
+                    _mm256_cmp_pd(cube, _mm256_setzero_pd(), _CMP_GT_OQ),
+                    _mm256_cmp_pd(u,
+                                  _mm256_sub_pd(ONE_PACKED_DOUBLE, _mm256_mul_pd(_mm256_set1_pd(0.0331),
+                                                                                 _mm256_mul_pd(x_squared, x_squared))),
+                                  _CMP_LT_OQ)));
+
+                if (__builtin_expect(accepted != 0xF, 0))
+                {
+                    alignas(32) double lane_x[4];
+                    alignas(32) double lane_u[4];
+
+                    _mm256_store_pd(v, cube);
+                    _mm256_store_pd(lane_x, x);
+                    _mm256_store_pd(lane_u, u);
+
+                    gamma_slow_path(sampler, v, lane_x, lane_u, accepted);
+
+                    cube = _mm256_load_pd(v);
+                }
+
+                __m256d result =
+                    _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(sampler.d), cube), _mm256_set1_pd(sampler.scale));
+
+                if (sampler.boosted)
+                {
+                    _mm256_store_pd(v, _mm256_sub_pd(ONE_PACKED_DOUBLE, dnext4()));
+
+                    result = _mm256_mul_pd(result, _mm256_setr_pd(std::pow(v[0], sampler.inverse_shape),
+                                                                  std::pow(v[1], sampler.inverse_shape),
+                                                                  std::pow(v[2], sampler.inverse_shape),
+                                                                  std::pow(v[3], sampler.inverse_shape)));
+                }
+
+                return result;
+            }
+            else
+            {
+                const auto normals = normal4();
+                const auto uniforms = dnext4();
+
+                double x[4];
+                double u[4];
+                int accepted = 0;
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    x[i] = normals[i];
+                    u[i] = uniforms[i];
+                    v[i] = gamma_cube(sampler, x[i]);
+
+                    accepted |= gamma_squeeze_accepts(x[i], u[i], v[i]) << i;
+                }
+
+                if (__builtin_expect(accepted != 0xF, 0))
+                {
+                    gamma_slow_path(sampler, v, x, u, accepted);
+                }
+
+                __m256d result;
+
+                for (size_t i = 0; i < 4; i++)
+                {
+                    result[i] = (sampler.d * v[i]) * sampler.scale;
+                }
+
+                if (sampler.boosted)
+                {
+                    const auto boosts = dnext4();
+
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        result[i] *= std::pow(1.0 - boosts[i], sampler.inverse_shape);
+                    }
+                }
+
+                return result;
+            }
+        }
+
+        __m256d beta4_internal(const GammaSampler& a_sampler, const GammaSampler& b_sampler)
+        {
+            const __m256d x = gamma4_internal(a_sampler);
+            const __m256d y = gamma4_internal(b_sampler);
+
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                return _mm256_div_pd(x, _mm256_add_pd(x, y));
+            }
+            else
+            {
+                return x / (x + y);
+            }
+        }
+
+        //  Float in [0,1) from the upper 23 bits of a 32 bit half, the same mantissa trick as dnext().
+
+        static inline float unit_float(uint32_t half)
+        {
+            union
+            {
+                uint32_t int_value;
+                float float_value;
+            };
+
+            int_value = (half >> 9) | FLOAT_MASK;
+
+            return float_value - 1.0f;
+        }
+
+        //
+        //  Unit interval conversions for dnext<UnitInterval>() and dnext4<UnitInterval>()
+        //
+
+        static constexpr double TWO_TO_MINUS_53 = 0x1.0p-53;
+        static constexpr double TWO_TO_MINUS_64 = 0x1.0p-64;
+        static constexpr double OPEN_INTERVAL_OFFSET = 1.0 - 0x1.0p-53;
+
+        template <UnitInterval INTERVAL>
+        static inline double unit_double(uint64_t draw)
+        {
+            if constexpr ((INTERVAL == UnitInterval::ClosedOpen52) || (INTERVAL == UnitInterval::Open))
+            {
+                union
+                {
+                    uint64_t int_value;
+                    double double_value;
+                };
+
+                int_value = (draw >> 12) | DOUBLE_MASK;
+
+                return double_value - (INTERVAL == UnitInterval::Open ? OPEN_INTERVAL_OFFSET : 1.0);
+            }
+            else if constexpr (INTERVAL == UnitInterval::ClosedOpen53)
+            {
+                return (double)(int64_t)(draw >> 11) * TWO_TO_MINUS_53;
+            }
+            else if constexpr (INTERVAL == UnitInterval::Closed)
+            {
+                return (double)(int64_t)(((draw >> 10) + 1) >> 1) * TWO_TO_MINUS_53;
+            }
+            else
+            {
+                //  Draws below 2^53 convert exactly, larger ones lose the bits below the leading 53.  The halves are
+                //      converted separately as signed values, the unsigned conversion of a 64 bit value branches on
+                //      the top bit.
+
+                const uint64_t dropped_bits = draw >= (UINT64_C(1) << 53) ? 11 - __builtin_clzll(draw) : 0;
+                const uint64_t kept = draw & (~UINT64_C(0) << dropped_bits);
+
+                return (((double)(int64_t)(kept >> 32) * 0x1.0p32) + (double)(int64_t)(kept & 0xFFFFFFFF)) *
+                       TWO_TO_MINUS_64;
+            }
+        }
+
+        //  Exact for values with at most 53 significant bits.
+
+        static inline __m256d exact_uint64_to_double4(__m256i values)
+        {
+            const __m256i two_to_52_bits = _mm256_set1_epi64x(UINT64_C(0x4330000000000000));
+            const __m256d two_to_52 = _mm256_castsi256_pd(two_to_52_bits);
+
+            const __m256d high = _mm256_sub_pd(
+                _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(values, 32), two_to_52_bits)), two_to_52);
+            const __m256d low = _mm256_sub_pd(
+                _mm256_castsi256_pd(_mm256_blend_epi32(values, two_to_52_bits, 0xAA)), two_to_52);
+
+            return _mm256_add_pd(_mm256_mul_pd(high, _mm256_set1_pd(0x1.0p32)), low);
+        }
+
+        template <UnitInterval INTERVAL>
+        static inline __m256d unit_doubles4(__m256i draws)
+        {
+            if constexpr ((INTERVAL == UnitInterval::ClosedOpen52) || (INTERVAL == UnitInterval::Open))
+            {
+                return _mm256_sub_pd(
+                    _mm256_castsi256_pd(_mm256_or_si256(DOUBLE_MASK_PACKED, _mm256_srli_epi64(draws, 12))),
+                    _mm256_set1_pd(INTERVAL == UnitInterval::Open ? OPEN_INTERVAL_OFFSET : 1.0));
+            }
+            else if constexpr (INTERVAL == UnitInterval::ClosedOpen53)
+            {
+                return _mm256_mul_pd(exact_uint64_to_double4(_mm256_srli_epi64(draws, 11)),
+                                     _mm256_set1_pd(TWO_TO_MINUS_53));
+            }
+            else if constexpr (INTERVAL == UnitInterval::Closed)
+            {
+                return _mm256_mul_pd(exact_uint64_to_double4(_mm256_srli_epi64(
+                                         _mm256_add_epi64(_mm256_srli_epi64(draws, 10), ONE_PACKED_INT64), 1)),
+                                     _mm256_set1_pd(TWO_TO_MINUS_53));
+            }
+            else
+            {
+                //  The leading bit of the draw is bit (exponent - 1023) + 11 of the exact conversion of draw >> 11,
+                //      so the bits below the leading 53 number exponent - 1064.  Draws below 2^53 keep every bit.
+
+                const __m256i exponents =
+                    _mm256_srli_epi64(_mm256_castpd_si256(exact_uint64_to_double4(_mm256_srli_epi64(draws, 11))), 52);
+                const __m256i dropped_bits =
+                    _mm256_and_si256(_mm256_sub_epi64(exponents, _mm256_set1_epi64x(1064)),
+                                     _mm256_cmpgt_epi64(exponents, _mm256_set1_epi64x(1064)));
+
+                return _mm256_mul_pd(exact_uint64_to_double4(_mm256_and_si256(
+                                         draws, _mm256_sllv_epi64(_mm256_set1_epi64x(-1), dropped_bits))),
+                                     _mm256_set1_pd(TWO_TO_MINUS_64));
+            }
+        }
+
+        //
+        //  Ziggurat helpers shared by normal() and the serial and AVX2 normal4()
+        //
+
+        static inline size_t ziggurat_layer(uint64_t draw) { return (draw >> 4) & (NormalZiggurat::NUM_LAYERS - 1); }
 
-                return packed_result;
-            }
-        }
+        //  Uniform in [-1,1) from the top 52 bits, the same mantissa trick as dnext().
 
-        FourDoubleValues dnext4(double lower_bound, double upper_bound)
+        static inline double ziggurat_signed_unit(uint64_t draw)
         {
             union
             {
-                std::array<double, 4> upper_bounded_array;
-                __m256d upper_bounded_packed_double;
+                uint64_t int_value;
+                double double_value;
             };
 
-            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
-            {
-                return _mm256_add_pd( _mm256_mul_pd( dnext4(), _mm256_set1_pd( upper_bound - lower_bound) ), _mm256_set1_pd(lower_bound));
-            }
-            else
-            {
-                auto    result = dnext4();
+            int_value = (draw >> 12) | DOUBLE_MASK;
 
-                result.result_packed_[0] = ( result.result_packed_[0] * ( upper_bound - lower_bound)) + lower_bound;
-                result.result_packed_[1] = ( result.result_packed_[1] * ( upper_bound - lower_bound)) + lower_bound;
-                result.result_packed_[2] = ( result.result_packed_[2] * ( upper_bound - lower_bound)) + lower_bound;
-                result.result_packed_[3] = ( result.result_packed_[3] * ( upper_bound - lower_bound)) + lower_bound;
-            
-                return result;
-            }
+            return (double_value + double_value) - 3.0;
         }
 
-        //
-        //  Jump Functions
-        //
+        //  Uniform in (0,1], safe to take the log of.
 
-        //  This is the jump function for the generator. It is equivalent
-        //     to 2^128 calls to next(); it can be used to generate 2^128
-        //     non-overlapping subsequences for parallel computations.
+        static inline double ziggurat_open_unit(uint64_t draw) { return ((draw >> 11) + 1) * 0x1.0p-53; }
 
-        static std::array<uint64_t, 4> jump(const std::array<uint64_t, 4>& initial_state)
+        //  x lies in the wedge of layer between X[layer + 1] and X[layer], it is accepted if a uniform height in the
+        //      wedge falls below f(x).  Both edges are scaled by f(x), so only differences of squares are exponentiated.
+
+        static inline bool ziggurat_wedge_accepts(size_t layer, double x, uint64_t draw)
         {
-            static const uint64_t JUMP[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa,
-                                            0x39abdc4529b1661c};
+            const double x_squared = x * x;
 
-            std::array<uint64_t, 4> local_state(initial_state);
-            std::array<uint64_t, 4> temp({0, 0, 0, 0});
+            const double f_outer =
+                std::exp(-0.5 * ((NormalZiggurat::X[layer] * NormalZiggurat::X[layer]) - x_squared));
+            const double f_inner =
+                std::exp(-0.5 * ((NormalZiggurat::X[layer + 1] * NormalZiggurat::X[layer + 1]) - x_squared));
 
-            for (int i = 0; i < sizeof JUMP / sizeof *JUMP; i++)
+            union
             {
-                for (int b = 0; b < 64; b++)
-                {
-                    if (JUMP[i] & UINT64_C(1) << b)
-                    {
-                        temp[0] ^= local_state[0];
-                        temp[1] ^= local_state[1];
-                        temp[2] ^= local_state[2];
-                        temp[3] ^= local_state[3];
-                    }
+                uint64_t int_value;
+                double double_value;
+            };
 
-                    next_internal(local_state);
-                }
-            }
+            int_value = (draw >> 12) | DOUBLE_MASK;
 
-            return temp;
+            return f_outer + ((double_value - 1.0) * (f_inner - f_outer)) < 1.0;
         }
 
-        //  This is the long-jump function for the generator. It is equivalent to
-        //      2^192 calls to next(); it can be used to generate 2^64 starting points,
-        //      from each of which jump() will generate 2^64 non-overlapping
-        //      subsequences for parallel distributed computations.
+        //  Marsaglia's tail method, tail_x receives the magnitude of an accepted value beyond R.
 
-        static std::array<uint64_t, 4> long_jump(const std::array<uint64_t, 4>& initial_state)
+        static inline bool ziggurat_tail_accepts(uint64_t first_draw, uint64_t second_draw, double& tail_x)
         {
-            static const uint64_t LONG_JUMP[] = {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241,
-                                                 0x39109bb02acbe635};
+            const double x = -std::log(ziggurat_open_unit(first_draw)) / NormalZiggurat::R;
+            const double y = -std::log(ziggurat_open_unit(second_draw));
 
-            std::array<uint64_t, 4> local_state(initial_state);
-            std::array<uint64_t, 4> temp({0, 0, 0, 0});
+            tail_x = NormalZiggurat::R + x;
 
-            for (int i = 0; i < sizeof LONG_JUMP / sizeof *LONG_JUMP; i++)
+            return (y + y) >= (x * x);
+        }
+
+        //  Resolves the lanes of a normal4() step which failed the fast test.  values holds the candidates and
+        //      accepted has bit i set for each lane already done.  Wedge lanes share one four wide draw for their
+        //      heights, tail lanes share pairs of draws until each is accepted, and rejected lanes take new candidates
+        //      from a further four wide draw.
+
+        void normal4_slow_path(double (&values)[4], uint64_t (&layers)[4], int accepted)
+        {
+            while (accepted != 0xF)
             {
-                for (int b = 0; b < 64; b++)
+                int wedge_lanes = 0;
+                int tail_lanes = 0;
+
+                for (size_t i = 0; i < 4; i++)
                 {
-                    if (LONG_JUMP[i] & UINT64_C(1) << b)
+                    if (!(accepted & (1 << i)))
                     {
-                        temp[0] ^= local_state[0];
-                        temp[1] ^= local_state[1];
-                        temp[2] ^= local_state[2];
-                        temp[3] ^= local_state[3];
+                        (layers[i] == 0 ? tail_lanes : wedge_lanes) |= 1 << i;
                     }
+                }
 
-                    next_internal(local_state);
+                if (wedge_lanes != 0)
+                {
+                    const auto draws = next4();
+
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        if ((wedge_lanes & (1 << i)) && ziggurat_wedge_accepts(layers[i], values[i], draws[i]))
+                        {
+                            accepted |= 1 << i;
+                        }
+                    }
+                }
+
+                while (tail_lanes != 0)
+                {
+                    const auto first_draws = next4();
+                    const auto second_draws = next4();
+
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        double tail_x;
+
+                        if ((tail_lanes & (1 << i)) && ziggurat_tail_accepts(first_draws[i], second_draws[i], tail_x))
+                        {
+                            values[i] = values[i] < 0 ? -tail_x : tail_x;
+                            tail_lanes &= ~(1 << i);
+                            accepted |= 1 << i;
+                        }
+                    }
+                }
+
+                if (accepted != 0xF)
+                {
+                    const auto draws = next4();
+
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        if (!(accepted & (1 << i)))
+                        {
+                            layers[i] = ziggurat_layer(draws[i]);
+
+                            const double u = ziggurat_signed_unit(draws[i]);
+
+                            values[i] = u * NormalZiggurat::X[layers[i]];
+                            accepted |= (std::abs(u) < NormalZiggurat::RATIO[layers[i]]) << i;
+                        }
+                    }
                 }
             }
+        }
 
-            return temp;
+        static constexpr uint32_t log2_of_power_of_two(uint32_t value)
+        {
+            return value == 1 ? 0 : 1 + log2_of_power_of_two(value >> 1);
         }
 
-       private:
-        static constexpr uint64_t DOUBLE_MASK = UINT64_C(0x3FF) << 52;
+        static inline __m256i packed_lanes(const std::array<uint32_t, 4>& values)
+        {
+            return (__m256i)(__v4di){values[0], values[1], values[2], values[3]};
+        }
 
-        typedef std::array<uint64_t, 4> SerialState;
+        //  The bounds are uint32 values in 64 bit lanes, so the signed compare is safe.
 
-        alignas(32) SerialState serial_state_;
+        static inline void assert_lane_bounds(const __m256i lower_bounds, const __m256i upper_bounds)
+        {
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                assert(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(upper_bounds, lower_bounds))) == 0xF);
+            }
+            else
+            {
+                for (size_t i = 0; i < 4; i++)
+                {
+                    assert((uint32_t)upper_bounds[i] > (uint32_t)lower_bounds[i]);
+                }
+            }
+        }
 
-        alignas(32) std::array<SerialState, 4> serial_next4_state_;
+        //  High 64 bits of the unsigned 128 bit products of each lane.  With a = ah * 2^32 + al and b = bh * 2^32 + bl
+        //      the low cross terms are summed in 64 bits first, so the carry into the high half is exact.
 
-        static inline constexpr __m256d cnstexpr_mm256_set1_pd(double value)
+        static inline __m256i mulhi_epu64(const __m256i a, const __m256i b)
         {
-            return (__m256d){value, value, value, value};
-        };
+            const __m256i low_bits_mask = _mm256_set1_epi64x(0xFFFFFFFF);
 
-        static inline constexpr __m256i cnstexpr_mm256_set1_epi64x(int64_t value)
-        {
-            return (__m256i)(__v4di){value, value, value, value};
-        };
+            const __m256i a_high = _mm256_srli_epi64(a, 32);
+            const __m256i b_high = _mm256_srli_epi64(b, 32);
 
-        static constexpr __m256i DOUBLE_MASK_PACKED = cnstexpr_mm256_set1_epi64x(DOUBLE_MASK);
-        static constexpr __m256i ONE_PACKED_INT64 = cnstexpr_mm256_set1_epi64x(1);
-        static constexpr __m256i ZERO_PACKED_INT64 = cnstexpr_mm256_set1_epi64x(0);
-        static constexpr __m256d ONE_PACKED_DOUBLE = cnstexpr_mm256_set1_pd(1.0);
+            const __m256i low_low = _mm256_mul_epu32(a, b);
+            const __m256i low_high = _mm256_mul_epu32(a, b_high);
+            const __m256i high_low = _mm256_mul_epu32(a_high, b);
+            const __m256i high_high = _mm256_mul_epu32(a_high, b_high);
 
-#ifdef __AVX2_AVAILABLE__
+            const __m256i middle = _mm256_add_epi64(
+                _mm256_add_epi64(_mm256_srli_epi64(low_low, 32), _mm256_and_si256(low_high, low_bits_mask)),
+                _mm256_and_si256(high_low, low_bits_mask));
 
-        class alignas(32) SIMDState
+            return _mm256_add_epi64(
+                _mm256_add_epi64(high_high, _mm256_srli_epi64(middle, 32)),
+                _mm256_add_epi64(_mm256_srli_epi64(low_high, 32), _mm256_srli_epi64(high_low, 32)));
+        }
+
+        //  The distribution fills write count doubles from successive calls to next_four, which returns a packed
+        //      __m256d, the unused lanes of the final step are discarded.
+
+        template <typename NextFour>
+        void fill_doubles(double* buffer, size_t count, NextFour next_four)
         {
-           public:
-            SIMDState() {}
+            size_t i = 0;
 
-            SIMDState(const SIMDState& state_to_copy, JumpOnCopy jump_dist = JumpOnCopy::None)
-                : uint64_array_state_(state_to_copy.uint64_array_state_)
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
             {
-                switch (jump_dist)
+                for (; i + 4 <= count; i += 4)
                 {
-                    case JumpOnCopy::None:
-                        break;
-
-                    case JumpOnCopy::Short:
-                        uint64_array_state_[0] = jump(uint64_array_state_[0]);
-                        uint64_array_state_[1] = jump(uint64_array_state_[1]);
-                        uint64_array_state_[2] = jump(uint64_array_state_[2]);
-                        uint64_array_state_[3] = jump(uint64_array_state_[3]);
-                        break;
+                    _mm256_storeu_pd(buffer + i, next_four());
+                }
 
-                    case JumpOnCopy::Long:
-                        uint64_array_state_[0] = long_jump(uint64_array_state_[0]);
-                        uint64_array_state_[1] = long_jump(uint64_array_state_[1]);
-                        uint64_array_state_[2] = long_jump(uint64_array_state_[2]);
-                        uint64_array_state_[3] = long_jump(uint64_array_state_[3]);
-                        break;
+                if (i < count)
+                {
+                    _mm256_maskstore_pd(buffer + i, tail_mask(count - i), next_four());
                 }
             }
+            else
+            {
+                for (; i < count; i += 4)
+                {
+                    const __m256d values = next_four();
 
-            SIMDState(const std::array<SerialState, 4>& state) : SIMDState(state[0], state[1], state[2], state[3]) {}
+                    for (size_t j = 0; (j < 4) && (i + j < count); j++)
+                    {
+                        buffer[i + j] = values[j];
+                    }
+                }
+            }
+        }
 
-            SIMDState(const std::array<uint64_t, 4>& seed1, const std::array<uint64_t, 4>& seed2,
-                      const std::array<uint64_t, 4>& seed3, const std::array<uint64_t, 4>& seed4)
-            {
-                packed_state_[0][0] = seed1[0];
-                packed_state_[1][0] = seed1[1];
-                packed_state_[2][0] = seed1[2];
-                packed_state_[3][0] = seed1[3];
+        //  Writes count uint64s from successive calls to next_four, which returns a packed __m256i.
 
-                packed_state_[0][1] = seed2[0];
-                packed_state_[1][1] = seed2[1];
-                packed_state_[2][1] = seed2[2];
-                packed_state_[3][1] = seed2[3];
+        template <typename NextFour>
+        void fill_integers(uint64_t* buffer, size_t count, NextFour next_four)
+        {
+            size_t i = 0;
 
-                packed_state_[0][2] = seed3[0];
-                packed_state_[1][2] = seed3[1];
-                packed_state_[2][2] = seed3[2];
-                packed_state_[3][2] = seed3[3];
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                for (; i + 4 <= count; i += 4)
+                {
+                    _mm256_storeu_si256((__m256i*)(buffer + i), next_four());
+                }
 
-                packed_state_[0][3] = seed4[0];
-                packed_state_[1][3] = seed4[1];
-                packed_state_[2][3] = seed4[2];
-                packed_state_[3][3] = seed4[3];
+                if (i < count)
+                {
+                    _mm256_maskstore_epi64((long long*)(buffer + i), tail_mask(count - i), next_four());
+                }
             }
+            else
+            {
+                for (; i < count; i += 4)
+                {
+                    const __m256i values = next_four();
 
-            const __m256i operator[](size_t index) const { return packed_state_[index]; }
-            __m256i& operator[](size_t index) { return packed_state_[index]; }
+                    for (size_t j = 0; (j < 4) && (i + j < count); j++)
+                    {
+                        buffer[i + j] = values[j];
+                    }
+                }
+            }
+        }
 
-           private:
-            union
-            {
-                __m256i packed_state_[4];
-                std::array<std::array<uint64_t, 4>, 4> uint64_array_state_;
-            };
-        };
+        //  Compares 256 uniforms at a time with threshold = p * 2^64, a binary digit per next4() step from the most
+        //      significant down to the last one set.  A draw bit of one is a uniform digit of zero, so the raw bits
+        //      of the first step are the mask for p = 0.5.
 
-        static FourIntegerValues simd_next4_internal(SIMDState& state)
+        void bernoulli_fill_internal(uint8_t* bytes, size_t num_bytes, uint64_t threshold)
         {
-            FourIntegerValues result(_mm256_add_epi64(state[0], state[3]));
+            static_assert(LAYOUT != StateLayout::ScalarOnly, "ScalarOnly RNG has no lanes for bernoulli_fill()");
 
-            const __m256i temp = _mm256_slli_epi64(state[1], 17);
+            assert(threshold != 0);
 
-            state[2] = _mm256_xor_si256(state[2], state[0]);
-            state[3] = _mm256_xor_si256(state[3], state[1]);
-            state[1] = _mm256_xor_si256(state[1], state[2]);
-            state[0] = _mm256_xor_si256(state[0], state[3]);
+            ensure_lanes_initialized();
 
-            state[2] = _mm256_xor_si256(state[2], temp);
+            const int last_digit = __builtin_ctzll(threshold);
 
-            state[3] = rotl(state[3], 45);
+            if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+                SIMDBlock state(simd_state_[0]);
 
-            return result;
-        }
-#else
-        class SIMDState
-        {
-           public:
-            SIMDState() {}
-            SIMDState(const SIMDState& state_to_copy, JumpOnCopy jump_dist = JumpOnCopy::None) {}
-        };
-#endif
+                for (size_t i = 0; i < num_bytes; i += 32)
+                {
+                    __m256i mask = _mm256_setzero_si256();
+                    __m256i undecided = _mm256_set1_epi64x(-1);
 
-        SIMDState simd_state_;
+                    for (int digit = 63; (digit >= last_digit) && !_mm256_testz_si256(undecided, undecided); digit--)
+                    {
+                        const __m256i draws = simd_next4_internal(state);
+
+                        if ((threshold >> digit) & 1)
+                        {
+                            mask = _mm256_or_si256(mask, _mm256_and_si256(undecided, draws));
+                            undecided = _mm256_andnot_si256(draws, undecided);
+                        }
+                        else
+                        {
+                            undecided = _mm256_and_si256(undecided, draws);
+                        }
+                    }
 
-        static uint64_t next_internal(SerialState& state)
-        {
-            const uint64_t result = state[0] + state[3];
+                    if (i + 32 <= num_bytes)
+                    {
+                        _mm256_storeu_si256((__m256i*)(bytes + i), mask);
+                    }
+                    else
+                    {
+                        alignas(32) uint8_t block[32];
 
-            const uint64_t t = state[1] << 17;
+                        _mm256_store_si256((__m256i*)block, mask);
+                        memcpy(bytes + i, block, num_bytes - i);
+                    }
+                }
 
-            state[2] ^= state[0];
-            state[3] ^= state[1];
-            state[1] ^= state[2];
-            state[0] ^= state[3];
+                simd_state_[0] = state;
+            }
+            else
+            {
+                std::array<SerialState, LANES> state(serial_lanes_state_);
 
-            state[2] ^= t;
+                for (size_t i = 0; i < num_bytes; i += 32)
+                {
+                    uint64_t mask[4] = {0, 0, 0, 0};
+                    uint64_t undecided[4] = {~UINT64_C(0), ~UINT64_C(0), ~UINT64_C(0), ~UINT64_C(0)};
 
-            state[3] = rotl(state[3], 45);
+                    for (int digit = 63;
+                         (digit >= last_digit) && ((undecided[0] | undecided[1] | undecided[2] | undecided[3]) != 0);
+                         digit--)
+                    {
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            const uint64_t draw = next_internal(state[j]);
+
+                            if ((threshold >> digit) & 1)
+                            {
+                                mask[j] |= undecided[j] & draw;
+                                undecided[j] &= ~draw;
+                            }
+                            else
+                            {
+                                undecided[j] &= draw;
+                            }
+                        }
+                    }
 
-            return result;
+                    memcpy(bytes + i, mask, std::min(num_bytes - i, sizeof(mask)));
+                }
+
+                serial_lanes_state_ = state;
+            }
         }
 
-        static inline uint64_t rotl(const uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
-        static inline __m256i rotl(const __m256i x, int k)
+        //  Mask selecting the first num_lanes of a four wide value, used for masked stores of partial tails.
+
+        static inline __m256i tail_mask(size_t num_lanes)
         {
-            return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+            return _mm256_cmpgt_epi64(_mm256_set1_epi64x(num_lanes), _mm256_set_epi64x(3, 2, 1, 0));
         }
     };
+
+    //
+    //  Footprints of the state layouts.  Deferred lane initialization adds a flag, which pads out to one more
+    //      32 byte block.
+    //
+
+    static_assert(sizeof(Xoshiro256Plus<SIMDInstructionSet::NONE, 4, LaneInitialization::OnConstruction,
+                                        StateLayout::ScalarOnly>) == 32,
+                  "ScalarOnly RNG is the serial state alone");
+    static_assert(sizeof(Xoshiro256Plus<SIMDInstructionSet::NONE>) == 32 + (4 * 32),
+                  "NONE RNG is the serial state and four serial lanes");
+    static_assert(sizeof(Xoshiro256Plus<SIMDInstructionSet::NONE, 4, LaneInitialization::OnFirstUse>) ==
+                      32 + (4 * 32) + 32,
+                  "Deferred lane initialization flag pads to 32 bytes");
+
+#ifdef __AVX2_AVAILABLE__
+    static_assert(sizeof(Xoshiro256Plus<SIMDInstructionSet::AVX2, 4, LaneInitialization::OnConstruction,
+                                        StateLayout::ScalarOnly>) == 32,
+                  "ScalarOnly RNG is the serial state alone");
+    static_assert(sizeof(Xoshiro256Plus<SIMDInstructionSet::AVX2>) == 32 + (4 * 32),
+                  "SIMDOnly AVX2 RNG is the serial state and one four lane SIMD block");
+    static_assert(sizeof(Xoshiro256Plus<SIMDInstructionSet::AVX2, 8>) == 32 + (8 * 32),
+                  "SIMDOnly AVX2 RNG is the serial state and two four lane SIMD blocks");
+    static_assert(sizeof(Xoshiro256Plus<SIMDInstructionSet::AVX2, 4, LaneInitialization::OnConstruction,
+                                        StateLayout::Full>) == 32 + (4 * 32) + (4 * 32),
+                  "Full AVX2 RNG is the serial state, four serial lanes and one four lane SIMD block");
+#endif
+
+#ifdef __AVX512_AVAILABLE__
+    static_assert(sizeof(Xoshiro256Plus<SIMDInstructionSet::AVX512>) == 64 + (8 * 32),
+                  "SIMDOnly AVX512 RNG is the serial state, padded to the 64 byte alignment, and one eight lane block");
+#endif
 }  // namespace SEFUtility::RNG
@@ -0,0 +1,290 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "SplitMix64.h"
+
+/*
+    Bank of independent Xoshiro256+ streams
+
+    The bank holds one full Xoshiro256+ state per stream, for example one per particle in a simulation, and steps
+    every stream in lockstep.  The state is stored as a structure of arrays - one array per state word - so four (or
+    eight with AVX512) consecutive streams load straight into the lanes of a SIMD register, the same transposition
+    SIMDState uses for the lanes of a single RNG.
+
+    Stream states are derived from the bank seed and a 64 bit stream id, by default the index of the stream.  Stream
+    id is seeded exactly as Xoshiro256Plus(stream_seed(seed, id)), so any single stream can be reproduced outside
+    the bank.  The arrays are padded to a multiple of eight streams, the padding streams are all zero and never
+    written to the caller's array.
+*/
+
+namespace SEFUtility::RNG
+{
+    template <SIMDInstructionSet SIMD>
+    class Xoshiro256PlusBank
+    {
+       public:
+        Xoshiro256PlusBank(size_t num_streams, uint64_t seed) : Xoshiro256PlusBank(num_streams, seed, nullptr) {}
+
+        //  Stream i is seeded from ids[i] rather than from i.
+
+        Xoshiro256PlusBank(const uint64_t* ids, size_t num_streams, uint64_t seed)
+            : Xoshiro256PlusBank(num_streams, seed, ids)
+        {
+        }
+
+        size_t size() const { return num_streams_; }
+
+        //  The single RNG seed which reproduces stream id of a bank seeded with bank_seed.  The id is passed through
+        //      the SplitMix64 mixer so neighboring ids start far apart in the SplitMix64 sequence.
+
+        static uint64_t stream_seed(uint64_t bank_seed, uint64_t id) { return bank_seed ^ SplitMix64(id).next(); }
+
+        void seed_stream(size_t index, uint64_t id)
+        {
+            assert(index < num_streams_);
+
+            SplitMix64 split_mix(stream_seed(seed_, id));
+
+            for (size_t word = 0; word < 4; word++)
+            {
+                state_[word][index / STREAMS_PER_BLOCK].stream[index % STREAMS_PER_BLOCK] = split_mix.next();
+            }
+        }
+
+        std::array<uint64_t, 4> stream_state(size_t index) const
+        {
+            assert(index < num_streams_);
+
+            const size_t block = index / STREAMS_PER_BLOCK;
+            const size_t stream = index % STREAMS_PER_BLOCK;
+
+            return {state_[0][block].stream[stream], state_[1][block].stream[stream], state_[2][block].stream[stream],
+                    state_[3][block].stream[stream]};
+        }
+
+        //  Steps every stream once, values[i] receives the value from stream i.  values must hold size() entries
+        //      and need not be aligned.
+
+        void next(uint64_t* values)
+        {
+            if constexpr (SIMD >= SIMDInstructionSet::AVX512)
+            {
+#ifdef __AVX512_AVAILABLE__
+                const size_t full_blocks = num_streams_ / STREAMS_PER_BLOCK;
+
+                for (size_t block = 0; block < full_blocks; block++)
+                {
+                    _mm512_storeu_si512(values + (block * STREAMS_PER_BLOCK), simd_next8_internal(block));
+                }
+
+                if (full_blocks < state_[0].size())
+                {
+                    _mm512_mask_storeu_epi64(values + (full_blocks * STREAMS_PER_BLOCK),
+                                             (__mmask8)((1u << (num_streams_ % STREAMS_PER_BLOCK)) - 1),
+                                             simd_next8_internal(full_blocks));
+                }
+#endif
+            }
+            else if constexpr (SIMD >= SIMDInstructionSet::AVX2)
+            {
+#ifdef __AVX2_AVAILABLE__
+                const size_t full_quads = num_streams_ / 4;
+
+                for (size_t quad = 0; quad < full_quads; quad++)
+                {
+                    _mm256_storeu_si256((__m256i*)(values + (quad * 4)), simd_next4_internal(quad));
+                }
+
+                if ((num_streams_ % 4) != 0)
+                {
+                    _mm256_maskstore_epi64((long long*)(values + (full_quads * 4)),
+                                           _mm256_cmpgt_epi64(_mm256_set1_epi64x(num_streams_ % 4),
+                                                              _mm256_set_epi64x(3, 2, 1, 0)),
+                                           simd_next4_internal(full_quads));
+                }
+#endif
+            }
+            else
+            {
+                for (size_t block = 0; block < state_[0].size(); block++)
+                {
+                    serial_next(block, std::min(STREAMS_PER_BLOCK, num_streams_ - (block * STREAMS_PER_BLOCK)),
+                                values + (block * STREAMS_PER_BLOCK));
+                }
+            }
+        }
+
+       private:
+        static constexpr size_t STREAMS_PER_BLOCK = 8;
+
+        //  Eight streams' worth of one state word, aligned for a single AVX512 load or two AVX2 loads.
+
+        struct alignas(64) StreamBlock
+        {
+            uint64_t stream[STREAMS_PER_BLOCK];
+        };
+
+        uint64_t seed_;
+        size_t num_streams_;
+
+        std::array<std::vector<StreamBlock>, 4> state_;
+
+        Xoshiro256PlusBank(size_t num_streams, uint64_t seed, const uint64_t* ids)
+            : seed_(seed), num_streams_(num_streams)
+        {
+            static_assert(SIMD != SIMDInstructionSet::AVX, "AVX RNG bank is not supported - just use NONE");
+
+#ifndef __AVX2_AVAILABLE__
+            static_assert(SIMD == SIMDInstructionSet::NONE,
+                          "Cannot have an AVX2 RNG bank if AVX2 extensions are not available");
+#endif
+
+#ifndef __AVX512_AVAILABLE__
+            static_assert(SIMD < SIMDInstructionSet::AVX512,
+                          "Cannot have an AVX512 RNG bank if AVX512 extensions are not available");
+#endif
+
+            const size_t num_blocks = (num_streams + STREAMS_PER_BLOCK - 1) / STREAMS_PER_BLOCK;
+
+            for (auto& word : state_)
+            {
+                word.assign(num_blocks, StreamBlock{});
+            }
+
+            for (size_t i = 0; i < num_streams; i++)
+            {
+                seed_stream(i, ids == nullptr ? i : ids[i]);
+            }
+        }
+
+        //  Steps the streams of one block in a plain loop over the four state word arrays.
+
+        void serial_next(size_t block, size_t num_streams, uint64_t* __restrict values)
+        {
+            uint64_t* __restrict s0 = state_[0][block].stream;
+            uint64_t* __restrict s1 = state_[1][block].stream;
+            uint64_t* __restrict s2 = state_[2][block].stream;
+            uint64_t* __restrict s3 = state_[3][block].stream;
+
+            for (size_t i = 0; i < num_streams; i++)
+            {
+                uint64_t state0 = s0[i];
+                uint64_t state1 = s1[i];
+                uint64_t state2 = s2[i];
+                uint64_t state3 = s3[i];
+
+                values[i] = state0 + state3;
+
+                const uint64_t t = state1 << 17;
+
+                state2 ^= state0;
+                state3 ^= state1;
+                state1 ^= state2;
+                state0 ^= state3;
+
+                state2 ^= t;
+
+                s0[i] = state0;
+                s1[i] = state1;
+                s2[i] = state2;
+                s3[i] = (state3 << 45) | (state3 >> (64 - 45));
+            }
+        }
+
+#ifdef __AVX2_AVAILABLE__
+        //  Steps streams [4 * quad, 4 * quad + 4), the state words load straight into the four lanes.
+
+        __m256i simd_next4_internal(size_t quad)
+        {
+            __m256i* s0 = (__m256i*)(state_[0][quad / 2].stream + ((quad % 2) * 4));
+            __m256i* s1 = (__m256i*)(state_[1][quad / 2].stream + ((quad % 2) * 4));
+            __m256i* s2 = (__m256i*)(state_[2][quad / 2].stream + ((quad % 2) * 4));
+            __m256i* s3 = (__m256i*)(state_[3][quad / 2].stream + ((quad % 2) * 4));
+
+            __m256i state0 = _mm256_load_si256(s0);
+            __m256i state1 = _mm256_load_si256(s1);
+            __m256i state2 = _mm256_load_si256(s2);
+            __m256i state3 = _mm256_load_si256(s3);
+
+            const __m256i result = _mm256_add_epi64(state0, state3);
+
+            const __m256i temp = _mm256_slli_epi64(state1, 17);
+
+            state2 = _mm256_xor_si256(state2, state0);
+            state3 = _mm256_xor_si256(state3, state1);
+            state1 = _mm256_xor_si256(state1, state2);
+            state0 = _mm256_xor_si256(state0, state3);
+
+            state2 = _mm256_xor_si256(state2, temp);
+
+            state3 = _mm256_or_si256(_mm256_slli_epi64(state3, 45), _mm256_srli_epi64(state3, 64 - 45));
+
+            _mm256_store_si256(s0, state0);
+            _mm256_store_si256(s1, state1);
+            _mm256_store_si256(s2, state2);
+            _mm256_store_si256(s3, state3);
+
+            return result;
+        }
+#endif
+
+#ifdef __AVX512_AVAILABLE__
+        __m512i simd_next8_internal(size_t block)
+        {
+            __m512i state0 = _mm512_load_si512(state_[0][block].stream);
+            __m512i state1 = _mm512_load_si512(state_[1][block].stream);
+            __m512i state2 = _mm512_load_si512(state_[2][block].stream);
+            __m512i state3 = _mm512_load_si512(state_[3][block].stream);
+
+            const __m512i result = _mm512_add_epi64(state0, state3);
+
+            const __m512i temp = _mm512_slli_epi64(state1, 17);
+
+            state2 = _mm512_xor_si512(state2, state0);
+            state3 = _mm512_xor_si512(state3, state1);
+            state1 = _mm512_xor_si512(state1, state2);
+            state0 = _mm512_xor_si512(state0, state3);
+
+            state2 = _mm512_xor_si512(state2, temp);
+
+            state3 = _mm512_rol_epi64(state3, 45);
+
+            _mm512_store_si512(state_[0][block].stream, state0);
+            _mm512_store_si512(state_[1][block].stream, state1);
+            _mm512_store_si512(state_[2][block].stream, state2);
+            _mm512_store_si512(state_[3][block].stream, state3);
+
+            return result;
+        }
+#endif
+    };
+}  // namespace SEFUtility::RNG
@@ -0,0 +1,213 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+#include "Xoshiro256Plus.h"
+
+/*
+    Standard random engine adapter
+
+    Xoshiro256PlusEngine meets the UniformRandomBitGenerator requirements - result_type, min(), max() and
+    operator() - so it can drive std::shuffle, the std distributions or any library expecting a standard engine.
+    operator() serves values from an aligned block of BLOCK_SIZE uint64s which is refilled in bulk with
+    fill(uint64_t*), so the state stays in registers through the refill and a scalar consumer gets the throughput of
+    the SIMD path.  The values are those of successive next4() calls, the same for the serial, AVX2 and AVX512
+    engines and for any block size.
+
+    Beyond the bit generator requirements the engine has the seed(), discard(), equality and stream members of a
+    random number engine - only the seed_seq constructor is left out.  discard() skips whole blocks with the jump
+    polynomials rather than generating them.  An engine is seeded with a single uint64, so its state is the seed and
+    the number of values returned or discarded since: two engines are equal when both match, and the stream
+    operators write the two as text and rebuild an engine from them with seed() and discard().  The offset into the
+    buffered block is the position modulo BLOCK_SIZE, so it is not written separately.
+*/
+
+namespace SEFUtility::RNG
+{
+    template <SIMDInstructionSet SIMD, size_t BLOCK_SIZE = 256>
+    class Xoshiro256PlusEngine
+    {
+       public:
+        static_assert((BLOCK_SIZE >= 4) && ((BLOCK_SIZE % 4) == 0), "Block size must be a multiple of four");
+
+        typedef uint64_t result_type;
+
+        static constexpr result_type default_seed = 1;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        Xoshiro256PlusEngine() : Xoshiro256PlusEngine(default_seed) {}
+
+        explicit Xoshiro256PlusEngine(result_type seed) : rng_(seed), seed_(seed) {}
+
+        //  Copies continue the same sequence, the generator copy constructor would otherwise jump.
+
+        Xoshiro256PlusEngine(const Xoshiro256PlusEngine& engine_to_copy)
+            : rng_(engine_to_copy.rng_, Generator::JumpOnCopy::None),
+              block_(engine_to_copy.block_),
+              next_value_(engine_to_copy.next_value_),
+              seed_(engine_to_copy.seed_),
+              num_blocks_(engine_to_copy.num_blocks_)
+        {
+        }
+
+        Xoshiro256PlusEngine& operator=(const Xoshiro256PlusEngine& engine_to_copy)
+        {
+            rng_ = Generator(engine_to_copy.rng_, Generator::JumpOnCopy::None);
+            block_ = engine_to_copy.block_;
+            next_value_ = engine_to_copy.next_value_;
+            seed_ = engine_to_copy.seed_;
+            num_blocks_ = engine_to_copy.num_blocks_;
+
+            return *this;
+        }
+
+        void seed(result_type seed = default_seed)
+        {
+            rng_ = Generator(seed);
+            next_value_ = BLOCK_SIZE;
+            seed_ = seed;
+            num_blocks_ = 0;
+        }
+
+        result_type operator()()
+        {
+            if (next_value_ == BLOCK_SIZE)
+            {
+                refill();
+            }
+
+            return block_[next_value_++];
+        }
+
+        void discard(unsigned long long num_values)
+        {
+            const size_t num_buffered = BLOCK_SIZE - next_value_;
+
+            if (num_values <= num_buffered)
+            {
+                next_value_ += num_values;
+                return;
+            }
+
+            num_values -= num_buffered;
+
+            //  Each block is BLOCK_SIZE / 4 steps of the lanes
+
+            const unsigned long long num_skipped_blocks = num_values / BLOCK_SIZE;
+
+            rng_.discard((__uint128_t)num_skipped_blocks * (BLOCK_SIZE / 4));
+
+            num_blocks_ += num_skipped_blocks;
+            next_value_ = BLOCK_SIZE;
+
+            if ((num_values % BLOCK_SIZE) != 0)
+            {
+                refill();
+                next_value_ = num_values % BLOCK_SIZE;
+            }
+        }
+
+        //  Values returned or discarded since seeding.
+
+        unsigned long long position() const { return (num_blocks_ * BLOCK_SIZE) - (BLOCK_SIZE - next_value_); }
+
+        friend bool operator==(const Xoshiro256PlusEngine& lhs, const Xoshiro256PlusEngine& rhs)
+        {
+            return (lhs.seed_ == rhs.seed_) && (lhs.position() == rhs.position());
+        }
+
+        friend bool operator!=(const Xoshiro256PlusEngine& lhs, const Xoshiro256PlusEngine& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        //  Written as the seed and position in decimal, separated by a space.
+
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os,
+                                                             const Xoshiro256PlusEngine& engine)
+        {
+            const auto flags = os.flags(std::ios_base::dec | std::ios_base::left);
+            const CharT space = os.widen(' ');
+            const auto fill = os.fill(space);
+
+            os << engine.seed_ << space << engine.position();
+
+            os.flags(flags);
+            os.fill(fill);
+
+            return os;
+        }
+
+        //  The engine is left as it was if the values cannot be read.
+
+        template <typename CharT, typename Traits>
+        friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& is,
+                                                             Xoshiro256PlusEngine& engine)
+        {
+            const auto flags = is.flags(std::ios_base::dec | std::ios_base::skipws);
+
+            result_type seed;
+            unsigned long long position;
+
+            if (is >> seed >> position)
+            {
+                engine.seed(seed);
+                engine.discard(position);
+            }
+
+            is.flags(flags);
+
+            return is;
+        }
+
+       private:
+        typedef Xoshiro256Plus<SIMD> Generator;
+
+        Generator rng_;
+
+        alignas(64) std::array<uint64_t, BLOCK_SIZE> block_;
+
+        size_t next_value_ = BLOCK_SIZE;
+
+        result_type seed_;
+        unsigned long long num_blocks_ = 0;
+
+        void refill()
+        {
+            rng_.fill(block_.data(), BLOCK_SIZE);
+
+            next_value_ = 0;
+            num_blocks_++;
+        }
+    };
+}  // namespace SEFUtility::RNG
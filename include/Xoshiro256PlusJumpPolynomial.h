@@ -0,0 +1,168 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+/*
+    Jump polynomials for Xoshiro256+
+
+    The Xoshiro256+ state transition is linear over GF(2), so advancing the state by n steps is the same as
+    evaluating the polynomial x^n mod P(x) at the transition, where P(x) is the degree 256 characteristic polynomial
+    of the transition.  The JUMP and LONG_JUMP constants in Xoshiro256Plus are exactly x^(2^128) mod P(x) and
+    x^(2^192) mod P(x) - applying any other polynomial works the same way and costs the same 256 steps.
+
+    The polynomial for an arbitrary distance is assembled from a table of x^(2^i) mod P(x) with one multiplication
+    mod P(x) per set bit of the distance.  The table is built by repeated squaring the first time it is needed,
+    evaluating it as a constant expression exceeds the compilers' constexpr operation limits.
+*/
+
+namespace SEFUtility::RNG
+{
+    class JumpPolynomial
+    {
+       public:
+        typedef std::array<uint64_t, 4> Coefficients;
+
+        //  The default polynomial is 1, i.e. a jump of zero steps.
+
+        constexpr JumpPolynomial() : coefficients_({1, 0, 0, 0}) {}
+
+        constexpr explicit JumpPolynomial(const Coefficients& coefficients) : coefficients_(coefficients) {}
+
+        static JumpPolynomial for_distance(__uint128_t distance) { return for_distance_shifted(distance, 0); }
+
+        //  Distance of num_jumps * 2^128, the same as num_jumps applications of jump().
+
+        static JumpPolynomial for_jumps(uint64_t num_jumps) { return for_distance_shifted(num_jumps, 128); }
+
+        //  Distance of num_long_jumps * 2^192, the same as num_long_jumps applications of long_jump().
+
+        static JumpPolynomial for_long_jumps(uint64_t num_long_jumps)
+        {
+            return for_distance_shifted(num_long_jumps, 192);
+        }
+
+        const Coefficients& coefficients() const { return coefficients_; }
+
+        bool coefficient(size_t index) const { return (coefficients_[index / 64] >> (index % 64)) & 1; }
+
+        //  Multiplication composes jumps - the product jumps by the sum of the two distances.
+
+        constexpr JumpPolynomial operator*(const JumpPolynomial& multiplier) const
+        {
+            return JumpPolynomial(multiply(coefficients_, multiplier.coefficients_));
+        }
+
+        bool operator==(const JumpPolynomial& other) const { return coefficients_ == other.coefficients_; }
+        bool operator!=(const JumpPolynomial& other) const { return coefficients_ != other.coefficients_; }
+
+       private:
+        //  P(x) without its x^256 term
+
+        static constexpr Coefficients CHARACTERISTIC_POLYNOMIAL = {0x9d116f2bb0f0f001, 0x0280002bcefd1a5e,
+                                                                   0x04b4edcf26259f85, 0x0003c03c3f3ecb19};
+
+        Coefficients coefficients_;
+
+        //  Polynomial for distance * 2^shift.  The first factor is copied rather than multiplied by one, so a single
+        //      jump or long jump is a table lookup.
+
+        static JumpPolynomial for_distance_shifted(__uint128_t distance, size_t shift)
+        {
+            JumpPolynomial result;
+            bool result_is_one = true;
+
+            for (size_t i = shift; distance != 0; i++, distance >>= 1)
+            {
+                if (distance & 1)
+                {
+                    result = result_is_one ? JumpPolynomial(powers_of_two()[i])
+                                           : result * JumpPolynomial(powers_of_two()[i]);
+                    result_is_one = false;
+                }
+            }
+
+            return result;
+        }
+
+        //  Shift and add multiplication, the multiplicand is multiplied by x and reduced mod P(x) for every bit.
+
+        static constexpr Coefficients multiply(Coefficients multiplicand, const Coefficients& multiplier)
+        {
+            Coefficients result = {0, 0, 0, 0};
+
+            for (size_t i = 0; i < 256; i++)
+            {
+                if ((multiplier[i / 64] >> (i % 64)) & 1)
+                {
+                    result[0] ^= multiplicand[0];
+                    result[1] ^= multiplicand[1];
+                    result[2] ^= multiplicand[2];
+                    result[3] ^= multiplicand[3];
+                }
+
+                const uint64_t overflow = multiplicand[3] >> 63;
+
+                multiplicand[3] = (multiplicand[3] << 1) | (multiplicand[2] >> 63);
+                multiplicand[2] = (multiplicand[2] << 1) | (multiplicand[1] >> 63);
+                multiplicand[1] = (multiplicand[1] << 1) | (multiplicand[0] >> 63);
+                multiplicand[0] = multiplicand[0] << 1;
+
+                const uint64_t reduction_mask = ~(overflow - 1);
+
+                multiplicand[0] ^= CHARACTERISTIC_POLYNOMIAL[0] & reduction_mask;
+                multiplicand[1] ^= CHARACTERISTIC_POLYNOMIAL[1] & reduction_mask;
+                multiplicand[2] ^= CHARACTERISTIC_POLYNOMIAL[2] & reduction_mask;
+                multiplicand[3] ^= CHARACTERISTIC_POLYNOMIAL[3] & reduction_mask;
+            }
+
+            return result;
+        }
+
+        //  x^(2^i) mod P(x) for i in [0, 256), each entry the square of the one before.
+
+        static std::array<Coefficients, 256> compute_powers_of_two()
+        {
+            std::array<Coefficients, 256> powers = {};
+
+            powers[0] = {2, 0, 0, 0};
+
+            for (size_t i = 1; i < 256; i++)
+            {
+                powers[i] = multiply(powers[i - 1], powers[i - 1]);
+            }
+
+            return powers;
+        }
+
+        static const std::array<Coefficients, 256>& powers_of_two()
+        {
+            static const std::array<Coefficients, 256> POWERS_OF_TWO = compute_powers_of_two();
+
+            return POWERS_OF_TWO;
+        }
+    };
+}  // namespace SEFUtility::RNG
@@ -0,0 +1,369 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Xoshiro256Plus.h"
+
+/*
+    Deterministic multi-threaded fills
+
+    parallel_fill() writes exactly the values Xoshiro256Plus(seed).fill(buffer, count) would, using several threads.
+    The buffer is cut into chunks of chunk_size values and chunk c is the slice of the stream starting c * chunk_size
+    values in, reached with discard() - so the output depends only on the seed, never on the chunk size, the number
+    of threads, the instruction set or the order in which the chunks are filled.  The chunk size must be a whole
+    number of four wide steps, a multiple of four values or of eight for uint32_t and float.
+
+    Each thread starts with an equal contiguous run of chunks, taken from the front, and steals half of the largest
+    remaining run from its back once its own run is empty.  A run is a single atomic word holding its first and end
+    chunk, so taking and stealing are a compare and swap each.  A thread keeps its generator at the end of the last
+    chunk it filled, so the chunks of its own run follow one another with no jump at all and only stolen chunks pay
+    for a discard() of a few microseconds.
+
+    The threads come from a ParallelFill::ThreadPool - the calling thread and num_threads - 1 workers which wait on a
+    condition variable between fills - so a program filling buffers repeatedly should keep a pool and pass it to
+    parallel_fill(pool, ...).  The overload without a pool builds one for the call, starting and joining its workers
+    each time, which costs some tens of microseconds per thread and is only worthwhile for buffers of megabytes.
+    Fills are meant for buffers where the memory bandwidth rather than the generator is the limit.  Fills on one pool
+    from several threads run one after another.
+*/
+
+namespace SEFUtility::RNG
+{
+    namespace ParallelFill
+    {
+        constexpr size_t DEFAULT_CHUNK_SIZE = 65536;
+
+        //  Values written per four wide step
+
+        template <typename T>
+        constexpr size_t values_per_step()
+        {
+            return sizeof(T) == sizeof(uint32_t) ? 8 : 4;
+        }
+
+        class ChunkRuns
+        {
+           public:
+            ChunkRuns(uint64_t num_chunks, size_t num_threads) : runs_(num_threads)
+            {
+                assert(num_chunks <= UINT32_MAX);
+
+                for (size_t i = 0; i < num_threads; i++)
+                {
+                    runs_[i].chunks.store(pack((num_chunks * i) / num_threads, (num_chunks * (i + 1)) / num_threads),
+                                          std::memory_order_relaxed);
+                }
+            }
+
+            //  The next chunk for thread, from its own run or stolen, false once every chunk has been taken.
+
+            bool next(size_t thread, uint64_t& chunk)
+            {
+                return take_first(thread, chunk) || steal(thread, chunk);
+            }
+
+           private:
+            struct alignas(64) Run
+            {
+                std::atomic<uint64_t> chunks;
+            };
+
+            std::vector<Run> runs_;
+
+            static uint64_t pack(uint64_t first, uint64_t end) { return (end << 32) | first; }
+            static uint64_t first(uint64_t run) { return run & UINT32_MAX; }
+            static uint64_t end(uint64_t run) { return run >> 32; }
+            static uint64_t size(uint64_t run) { return end(run) > first(run) ? end(run) - first(run) : 0; }
+
+            bool take_first(size_t thread, uint64_t& chunk)
+            {
+                uint64_t run = runs_[thread].chunks.load(std::memory_order_relaxed);
+
+                while (size(run) > 0)
+                {
+                    if (runs_[thread].chunks.compare_exchange_weak(run, pack(first(run) + 1, end(run)),
+                                                                   std::memory_order_relaxed))
+                    {
+                        chunk = first(run);
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            //  Only the owner refills its own run and only once it is empty, so a thief's store never overwrites
+            //      chunks.  A run can only return to a value a stale thief saw if it again holds exactly those chunks,
+            //      so the compare and swap is safe from ABA.
+
+            bool steal(size_t thread, uint64_t& chunk)
+            {
+                while (true)
+                {
+                    size_t victim = thread;
+                    uint64_t victim_run = 0;
+
+                    for (size_t i = 0; i < runs_.size(); i++)
+                    {
+                        const uint64_t run = runs_[i].chunks.load(std::memory_order_relaxed);
+
+                        if (size(run) > size(victim_run))
+                        {
+                            victim = i;
+                            victim_run = run;
+                        }
+                    }
+
+                    if (size(victim_run) == 0)
+                    {
+                        return false;
+                    }
+
+                    const uint64_t stolen_first = end(victim_run) - ((size(victim_run) + 1) / 2);
+
+                    if (runs_[victim].chunks.compare_exchange_strong(
+                            victim_run, pack(first(victim_run), stolen_first), std::memory_order_relaxed))
+                    {
+                        runs_[thread].chunks.store(pack(stolen_first + 1, end(victim_run)), std::memory_order_relaxed);
+
+                        chunk = stolen_first;
+                        return true;
+                    }
+                }
+            }
+        };
+
+        //  Persistent workers for parallel_fill().  run(task) calls task(i) for each i in [0, num_threads()), index 0
+        //      on the calling thread, and returns once all of them have finished.
+
+        class ThreadPool
+        {
+           public:
+            //  num_threads counts the calling thread, zero uses std::thread::hardware_concurrency() threads.
+
+            explicit ThreadPool(size_t num_threads = 0)
+            {
+                if (num_threads == 0)
+                {
+                    num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+                }
+
+                workers_.reserve(num_threads - 1);
+
+                for (size_t i = 1; i < num_threads; i++)
+                {
+                    workers_.emplace_back(&ThreadPool::work, this, i);
+                }
+            }
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            ~ThreadPool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    stopping_ = true;
+                }
+
+                start_.notify_all();
+
+                for (auto& worker : workers_)
+                {
+                    worker.join();
+                }
+            }
+
+            size_t num_threads() const { return workers_.size() + 1; }
+
+            template <typename F>
+            void run(F& task)
+            {
+                std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    task_ = [](void* context, size_t thread) { (*static_cast<F*>(context))(thread); };
+                    task_context_ = &task;
+                    num_running_ = workers_.size();
+                    generation_++;
+                }
+
+                start_.notify_all();
+
+                task(0);
+
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                finished_.wait(lock, [this] { return num_running_ == 0; });
+            }
+
+           private:
+            std::vector<std::thread> workers_;
+
+            std::mutex run_mutex_;
+
+            std::mutex mutex_;
+            std::condition_variable start_;
+            std::condition_variable finished_;
+
+            void (*task_)(void*, size_t) = nullptr;
+            void* task_context_ = nullptr;
+            uint64_t generation_ = 0;
+            size_t num_running_ = 0;
+            bool stopping_ = false;
+
+            void work(size_t thread)
+            {
+                uint64_t generation = 0;
+
+                while (true)
+                {
+                    void (*task)(void*, size_t);
+                    void* task_context;
+
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+
+                        start_.wait(lock, [this, generation] { return stopping_ || (generation_ != generation); });
+
+                        if (stopping_)
+                        {
+                            return;
+                        }
+
+                        generation = generation_;
+                        task = task_;
+                        task_context = task_context_;
+                    }
+
+                    task(task_context, thread);
+
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    if (--num_running_ == 0)
+                    {
+                        finished_.notify_one();
+                    }
+                }
+            }
+        };
+    }  // namespace ParallelFill
+
+    template <SIMDInstructionSet SIMD, typename T>
+    void parallel_fill(ParallelFill::ThreadPool& pool, uint64_t seed, T* buffer, size_t count,
+                       size_t chunk_size = ParallelFill::DEFAULT_CHUNK_SIZE)
+    {
+        typedef Xoshiro256Plus<SIMD> RNG;
+
+        constexpr size_t VALUES_PER_STEP = ParallelFill::values_per_step<T>();
+
+        assert((chunk_size > 0) && ((chunk_size % VALUES_PER_STEP) == 0));
+
+        const uint64_t num_chunks = (count + chunk_size - 1) / chunk_size;
+        const uint64_t steps_per_chunk = chunk_size / VALUES_PER_STEP;
+
+        //  Pool threads beyond the number of chunks return straight away.
+
+        const size_t num_threads = std::max<size_t>(std::min<uint64_t>(pool.num_threads(), num_chunks), 1);
+
+        const RNG stream_start(seed);
+
+        ParallelFill::ChunkRuns chunk_runs(num_chunks, num_threads);
+
+        auto fill_chunks = [&](size_t thread) {
+            if (thread >= num_threads)
+            {
+                return;
+            }
+
+            RNG rng(stream_start, RNG::JumpOnCopy::None);
+            uint64_t rng_chunk = 0;
+            uint64_t chunk;
+
+            while (chunk_runs.next(thread, chunk))
+            {
+                if (chunk < rng_chunk)
+                {
+                    rng = RNG(stream_start, RNG::JumpOnCopy::None);
+                    rng_chunk = 0;
+                }
+
+                if (chunk != rng_chunk)
+                {
+                    rng.discard((__uint128_t)(chunk - rng_chunk) * steps_per_chunk);
+                }
+
+                const size_t chunk_start = chunk * chunk_size;
+
+                rng.fill(buffer + chunk_start, std::min(chunk_size, count - chunk_start));
+                rng_chunk = chunk + 1;
+            }
+        };
+
+        //  A single chunk needs no other threads
+
+        if (num_threads == 1)
+        {
+            fill_chunks(0);
+        }
+        else
+        {
+            pool.run(fill_chunks);
+        }
+    }
+
+    //  Builds a pool for the one call.  num_threads of zero uses std::thread::hardware_concurrency() threads.
+
+    template <SIMDInstructionSet SIMD, typename T>
+    void parallel_fill(uint64_t seed, T* buffer, size_t count, size_t chunk_size = ParallelFill::DEFAULT_CHUNK_SIZE,
+                       size_t num_threads = 0)
+    {
+        assert(chunk_size > 0);
+
+        if (num_threads == 0)
+        {
+            num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        //  No more threads than chunks
+
+        const uint64_t num_chunks = (count + chunk_size - 1) / chunk_size;
+
+        ParallelFill::ThreadPool pool(std::max<size_t>(std::min<uint64_t>(num_threads, num_chunks), 1));
+
+        parallel_fill<SIMD>(pool, seed, buffer, count, chunk_size);
+    }
+}  // namespace SEFUtility::RNG
@@ -0,0 +1,227 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Xoshiro256Plus.h"
+
+/*
+    Pool of per thread generators
+
+    The pool is seeded once and hands out one generator per thread or task index.  Generator i is the seeded
+    generator copied with JumpOnCopy::Short i + 1 times - each generator is a jump() copy of the state the one before
+    it started from - so the streams are 2^128 values apart, never overlap and depend only on the seed and the index,
+    the same streams as Xoshiro256Plus(seed) after jump_streams(i + 1).  Each generator sits in its own cache line
+    aligned slot so threads stepping neighboring generators do not share cache lines.  Generators are created on
+    first request and keep their address for the life of the pool.
+
+    local() returns the calling thread's generator.  The first call from a thread takes a lock and binds the thread
+    to the lowest index not yet bound, or to the index given to bind(), after which local() is a thread_local load
+    and compare.  Each thread caches a single pool of each type, a thread moving back and forth between two pools
+    takes the lock again on each switch but keeps its index in each.  A thread id reused by a new thread picks up the
+    generator of the thread which held it before, where that thread left off.
+
+    Threads which need the same stream on every run should bind(index) explicitly or use generator(index), the
+    order in which unbound threads first call local() is up to the scheduler.  An index is bound to at most one
+    thread, bind() refuses an index another thread holds.
+*/
+
+namespace SEFUtility::RNG
+{
+    template <SIMDInstructionSet SIMD>
+    class Xoshiro256PlusPool
+    {
+       public:
+        typedef Xoshiro256Plus<SIMD> RNG;
+
+        explicit Xoshiro256PlusPool(uint64_t seed) : master_(seed), id_(++last_pool_id_) {}
+
+        Xoshiro256PlusPool(const Xoshiro256PlusPool&) = delete;
+        Xoshiro256PlusPool& operator=(const Xoshiro256PlusPool&) = delete;
+
+        RNG& local()
+        {
+            if (__builtin_expect(local_cache_.pool_id == id_, 1))
+            {
+                return *local_cache_.rng;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto thread_index = thread_indices_.find(std::this_thread::get_id());
+
+            if (thread_index != thread_indices_.end())
+            {
+                return cache_locked(thread_index->second);
+            }
+
+            while ((next_unbound_index_ < bound_.size()) && bound_[next_unbound_index_])
+            {
+                next_unbound_index_++;
+            }
+
+            return bind_locked(next_unbound_index_);
+        }
+
+        //  Binds the calling thread to index, later local() calls from the thread return generator(index).  Returns
+        //      false, leaving the thread's binding as it was, if another thread holds index.  A thread already bound
+        //      elsewhere gives up its old index, which another thread may then take, so references to the old
+        //      generator must not be used after a rebind.
+
+        bool bind(size_t index)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto thread_index = thread_indices_.find(std::this_thread::get_id());
+
+            if (thread_index != thread_indices_.end())
+            {
+                if (thread_index->second == index)
+                {
+                    cache_locked(index);
+                    return true;
+                }
+
+                if (is_bound_locked(index))
+                {
+                    return false;
+                }
+
+                unbind_locked(thread_index->second);
+            }
+            else if (is_bound_locked(index))
+            {
+                return false;
+            }
+
+            bind_locked(index);
+
+            return true;
+        }
+
+        //  The generator for index whether or not a thread is bound to it.  Takes the lock, so it is meant for
+        //      handing generators to tasks rather than for a hot loop.
+
+        RNG& generator(size_t index)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            return generator_locked(index);
+        }
+
+        size_t num_generators() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            return generators_.size();
+        }
+
+       private:
+        //  The alignment pads each generator out to whole cache lines.
+
+        struct alignas(64) PaddedRNG
+        {
+            explicit PaddedRNG(const RNG& rng_to_copy) : rng(rng_to_copy, RNG::JumpOnCopy::None) {}
+
+            RNG rng;
+        };
+
+        struct LocalCache
+        {
+            uint64_t pool_id = 0;
+            RNG* rng = nullptr;
+        };
+
+        //  Pool ids are never reused, so a cache left behind by a destroyed pool can never match a new one.
+
+        static inline std::atomic<uint64_t> last_pool_id_{0};
+        static inline thread_local LocalCache local_cache_;
+
+        //  Jumped once more for each generator created, so the generators are copied from untouched states whatever
+        //      has been drawn from the earlier ones.
+
+        RNG master_;
+        const uint64_t id_;
+
+        mutable std::mutex mutex_;
+
+        std::deque<PaddedRNG> generators_;
+        std::unordered_map<std::thread::id, size_t> thread_indices_;
+        std::vector<bool> bound_;
+        size_t next_unbound_index_ = 0;
+
+        RNG& generator_locked(size_t index)
+        {
+            while (generators_.size() <= index)
+            {
+                master_ = RNG(master_, RNG::JumpOnCopy::Short);
+                generators_.emplace_back(master_);
+            }
+
+            return generators_[index].rng;
+        }
+
+        bool is_bound_locked(size_t index) const { return (index < bound_.size()) && bound_[index]; }
+
+        void unbind_locked(size_t index)
+        {
+            bound_[index] = false;
+
+            if (index < next_unbound_index_)
+            {
+                next_unbound_index_ = index;
+            }
+        }
+
+        RNG& bind_locked(size_t index)
+        {
+            if (bound_.size() <= index)
+            {
+                bound_.resize(index + 1, false);
+            }
+
+            bound_[index] = true;
+            thread_indices_[std::this_thread::get_id()] = index;
+
+            return cache_locked(index);
+        }
+
+        RNG& cache_locked(size_t index)
+        {
+            RNG& rng = generator_locked(index);
+
+            local_cache_.pool_id = id_;
+            local_cache_.rng = &rng;
+
+            return rng;
+        }
+    };
+}  // namespace SEFUtility::RNG
@@ -0,0 +1,276 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Xoshiro256Plus.h"
+
+/*
+    Background producer of random blocks
+
+    Xoshiro256PlusProducer runs a thread which fills blocks of BLOCK_SIZE uint64s or doubles with the bulk fill - the
+    next4() or dnext4() values with the state held in registers - into a ring of depth cache line aligned blocks.  A
+    single consumer thread takes the filled blocks, so generating the values is off the consumer's path.  The blocks
+    come in the order Xoshiro256Plus(seed).fill() would write them, so the values are reproducible.
+
+    The ring is single producer, single consumer and lock free: the producer publishes a block by advancing the tail
+    and the consumer returns it by advancing the head, each index on its own cache line and each side keeping a copy
+    of the other's index so it only reads the shared line when its copy runs out.  try_pop() and pop() hand out a
+    pointer into the ring, no values are copied, and the block stays the consumer's until its next try_pop() or
+    pop() call.
+
+    When the ring is full the producer sleeps on a condition variable - the backpressure - and the consumer wakes it
+    on returning a block, taking the lock only when the producer is actually asleep.  An empty ring is an underrun:
+    try_pop() returns nullptr and pop() yields until the producer catches up.  Both are counted in stats(), along
+    with the blocks produced and consumed and the times the producer found the ring full.  The destructor, or
+    stop(), wakes and joins the producer, and pop() returns nullptr once the producer is stopped and the ring empty.
+*/
+
+namespace SEFUtility::RNG
+{
+    template <SIMDInstructionSet SIMD, typename T = uint64_t, size_t BLOCK_SIZE = 512>
+    class Xoshiro256PlusProducer
+    {
+       public:
+        static_assert(std::is_same<T, uint64_t>::value || std::is_same<T, double>::value,
+                      "Producer blocks must be uint64_t or double");
+        static_assert((BLOCK_SIZE >= 4) && ((BLOCK_SIZE % 4) == 0), "Block size must be a multiple of four");
+
+        struct Stats
+        {
+            uint64_t blocks_produced;
+            uint64_t blocks_consumed;
+            uint64_t underruns;
+            uint64_t producer_stalls;
+        };
+
+        static constexpr size_t block_size() { return BLOCK_SIZE; }
+
+        explicit Xoshiro256PlusProducer(uint64_t seed, size_t depth = 8) : rng_(seed), blocks_(depth)
+        {
+            assert(depth >= 2);
+
+            producer_ = std::thread(&Xoshiro256PlusProducer::produce, this);
+        }
+
+        Xoshiro256PlusProducer(const Xoshiro256PlusProducer&) = delete;
+        Xoshiro256PlusProducer& operator=(const Xoshiro256PlusProducer&) = delete;
+
+        ~Xoshiro256PlusProducer() { stop(); }
+
+        size_t depth() const { return blocks_.size(); }
+
+        //  The next block, or nullptr if none is ready.
+
+        const T* try_pop()
+        {
+            release_held_block();
+
+            if (!block_ready())
+            {
+                increment(underruns_);
+                return nullptr;
+            }
+
+            return hold_block();
+        }
+
+        //  The next block, waiting for it if need be.  nullptr only once the producer has stopped.
+
+        const T* pop()
+        {
+            release_held_block();
+
+            if (!block_ready())
+            {
+                increment(underruns_);
+
+                while (!block_ready())
+                {
+                    if (stopping_.load(std::memory_order_acquire) && !block_ready())
+                    {
+                        return nullptr;
+                    }
+
+                    std::this_thread::yield();
+                }
+            }
+
+            return hold_block();
+        }
+
+        void stop()
+        {
+            if (!producer_.joinable())
+            {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                stopping_.store(true, std::memory_order_release);
+            }
+
+            space_available_.notify_one();
+
+            producer_.join();
+        }
+
+        Stats stats() const
+        {
+            return Stats{blocks_produced_.load(std::memory_order_relaxed),
+                         blocks_consumed_.load(std::memory_order_relaxed), underruns_.load(std::memory_order_relaxed),
+                         producer_stalls_.load(std::memory_order_relaxed)};
+        }
+
+       private:
+        struct alignas(64) Block
+        {
+            std::array<T, BLOCK_SIZE> values;
+        };
+
+        Xoshiro256Plus<SIMD> rng_;
+
+        std::vector<Block> blocks_;
+
+        std::thread producer_;
+
+        std::mutex mutex_;
+        std::condition_variable space_available_;
+        std::atomic<bool> stopping_{false};
+
+        //  Producer side
+
+        alignas(64) std::atomic<uint64_t> tail_{0};
+        std::atomic<bool> producer_waiting_{false};
+        std::atomic<uint64_t> blocks_produced_{0};
+        std::atomic<uint64_t> producer_stalls_{0};
+
+        //  Consumer side
+
+        alignas(64) std::atomic<uint64_t> head_{0};
+        uint64_t consumer_tail_ = 0;
+        bool holding_block_ = false;
+        std::atomic<uint64_t> blocks_consumed_{0};
+        std::atomic<uint64_t> underruns_{0};
+
+        //  Each counter has a single writer, so a load and store is enough.
+
+        static void increment(std::atomic<uint64_t>& counter)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        bool block_ready()
+        {
+            const uint64_t head = head_.load(std::memory_order_relaxed);
+
+            if (head == consumer_tail_)
+            {
+                consumer_tail_ = tail_.load(std::memory_order_acquire);
+            }
+
+            return head != consumer_tail_;
+        }
+
+        const T* hold_block()
+        {
+            holding_block_ = true;
+            increment(blocks_consumed_);
+
+            return blocks_[head_.load(std::memory_order_relaxed) % blocks_.size()].values.data();
+        }
+
+        //  The head store and the producer_waiting_ load are sequentially consistent, as are the producer's store
+        //      and load of the two in the other order, so either the consumer sees the producer waiting or the
+        //      producer sees the returned block before it sleeps.
+
+        void release_held_block()
+        {
+            if (!holding_block_)
+            {
+                return;
+            }
+
+            holding_block_ = false;
+            head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+
+            if (producer_waiting_.load(std::memory_order_seq_cst))
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                space_available_.notify_one();
+            }
+        }
+
+        void produce()
+        {
+            const uint64_t depth = blocks_.size();
+
+            uint64_t tail = 0;
+            uint64_t producer_head = 0;
+
+            while (!stopping_.load(std::memory_order_acquire))
+            {
+                if (tail - producer_head == depth)
+                {
+                    producer_head = head_.load(std::memory_order_acquire);
+
+                    if (tail - producer_head == depth)
+                    {
+                        increment(producer_stalls_);
+
+                        std::unique_lock<std::mutex> lock(mutex_);
+
+                        producer_waiting_.store(true, std::memory_order_seq_cst);
+
+                        space_available_.wait(lock, [this, tail, depth] {
+                            return stopping_.load(std::memory_order_relaxed) ||
+                                   (tail - head_.load(std::memory_order_seq_cst) < depth);
+                        });
+
+                        producer_waiting_.store(false, std::memory_order_relaxed);
+
+                        continue;
+                    }
+                }
+
+                rng_.fill(blocks_[tail % depth].values.data(), BLOCK_SIZE);
+
+                tail_.store(++tail, std::memory_order_release);
+                increment(blocks_produced_);
+            }
+        }
+    };
+}  // namespace SEFUtility::RNG
@@ -0,0 +1,160 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+
+#include "Xoshiro256Plus.h"
+
+/*
+    Single stream shared between threads
+
+    The shared stream is the series of values fill(uint64_t*) writes from Xoshiro256Plus(seed), cut into blocks of
+    BLOCK_SIZE values.  A thread claims the next unclaimed block with a single atomic fetch_add and generates it
+    itself - the block index times BLOCK_SIZE / 4 lane steps is the distance of the block from the start of the
+    stream, so the block start is reached with discard_lanes() and the block written with the SIMD fill.  There is
+    no lock and the threads share nothing but the block counter.  Which thread gets which block depends on the
+    interleaving of the claims, but every block is claimed exactly once, so the values drawn by all the threads
+    together are always the same set, and each block's values can be regenerated from its index.
+
+    claim() jumps from the start of the stream and costs a few microseconds, the jump polynomial taking a
+    multiplication per set bit of the distance.  Only the lanes fill() reads are jumped, the serial state the blocks
+    never use is left where it is.  A Reader keeps a generator at the end of the last block its thread claimed and
+    jumps only over the blocks claimed by other threads in between, which needs no jump at all when the thread is
+    claiming alone and a handful of multiplications when the blocks are spread over a few dozen threads.  A Reader
+    belongs to a single thread and must not outlive its stream.
+*/
+
+namespace SEFUtility::RNG
+{
+    template <SIMDInstructionSet SIMD, size_t BLOCK_SIZE = 1024>
+    class Xoshiro256PlusShared
+    {
+       private:
+        typedef Xoshiro256Plus<SIMD> RNG;
+
+       public:
+        static_assert((BLOCK_SIZE >= 4) && ((BLOCK_SIZE % 4) == 0), "Block size must be a multiple of four");
+
+        static constexpr size_t block_size() { return BLOCK_SIZE; }
+
+        explicit Xoshiro256PlusShared(uint64_t seed) : stream_start_(seed) {}
+
+        Xoshiro256PlusShared(const Xoshiro256PlusShared&) = delete;
+        Xoshiro256PlusShared& operator=(const Xoshiro256PlusShared&) = delete;
+
+        //  Claims the next block and writes its BLOCK_SIZE values to block, returns the block index.
+
+        uint64_t claim(uint64_t* block)
+        {
+            const uint64_t block_index = claim_index();
+
+            generate(block_index, block);
+
+            return block_index;
+        }
+
+        //  Writes the values of any block, claimed or not.
+
+        void generate(uint64_t block_index, uint64_t* block) const
+        {
+            RNG rng(stream_start_, RNG::JumpOnCopy::None);
+
+            rng.discard_lanes((__uint128_t)block_index * STEPS_PER_BLOCK);
+            rng.fill(block, BLOCK_SIZE);
+        }
+
+        uint64_t num_blocks_claimed() const { return next_block_.load(std::memory_order_relaxed); }
+
+        class Reader
+        {
+           public:
+            explicit Reader(Xoshiro256PlusShared& shared)
+                : shared_(shared), rng_(shared.stream_start_, RNG::JumpOnCopy::None)
+            {
+            }
+
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+
+            uint64_t next()
+            {
+                if (next_value_ == BLOCK_SIZE)
+                {
+                    block_index_ = claim(block_.data());
+                    next_value_ = 0;
+                }
+
+                return block_[next_value_++];
+            }
+
+            //  Claims the next block into the caller's buffer, leaving the values buffered for next() in place.
+
+            uint64_t claim(uint64_t* block)
+            {
+                const uint64_t block_index = shared_.claim_index();
+
+                //  Claims only increase, so the generator is never ahead of the claimed block.
+
+                if (block_index != rng_block_)
+                {
+                    rng_.discard_lanes((__uint128_t)(block_index - rng_block_) * STEPS_PER_BLOCK);
+                }
+
+                rng_.fill(block, BLOCK_SIZE);
+                rng_block_ = block_index + 1;
+
+                return block_index;
+            }
+
+            //  Index of the block next() is returning values from.
+
+            uint64_t block_index() const { return block_index_; }
+
+           private:
+            Xoshiro256PlusShared& shared_;
+
+            RNG rng_;
+            uint64_t rng_block_ = 0;
+
+            alignas(64) std::array<uint64_t, BLOCK_SIZE> block_;
+
+            size_t next_value_ = BLOCK_SIZE;
+            uint64_t block_index_ = 0;
+        };
+
+       private:
+        static constexpr uint64_t STEPS_PER_BLOCK = BLOCK_SIZE / 4;
+
+        const RNG stream_start_;
+
+        //  On its own cache line, so the claims do not invalidate the line holding the stream start.
+
+        alignas(64) std::atomic<uint64_t> next_block_{0};
+
+        uint64_t claim_index() { return next_block_.fetch_add(1, std::memory_order_relaxed); }
+    };
+}  // namespace SEFUtility::RNG
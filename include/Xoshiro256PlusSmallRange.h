@@ -0,0 +1,133 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+/*
+    Several small range values from a single 64 bit draw
+
+    A value in [0, range) needs only log2(range) bits, a die roll about 2.6, but next(lower, upper) spends a whole
+    step on it.  The draw is instead treated as a fraction in [0,1) and multiplied by the range repeatedly - the
+    integer part of each product is a value and the fractional part is kept for the next one - the runtime range
+    counterpart of UniformInt.  Powers of two take log2(range) bits at a time and are exact.  Other ranges take
+    values while at least 32 bits of the fraction remain, so each value carries no more bias than the multiply and
+    shift reduction of next(lower, upper).  Ranges above 2^16 take one draw per value, the value of
+    next_64(0, range).
+
+    rng.next_small<K>(range) returns K values and discards what is left of its last draw.  SmallRangeDraw keeps the
+    remainder between calls and refills from next4(), so a stream of values costs a four wide step every
+    4 * values_per_draw() values - a six sided die gets 44 rolls per step.  Its values are taken from the four lanes
+    in turn, the first value of each lane, then the second of each and so on.  A SmallRangeDraw holds the remains of
+    the last step, so it should be used with a single RNG.
+*/
+
+namespace SEFUtility::RNG
+{
+    namespace SmallRange
+    {
+        //  ceil(log2(range))
+
+        constexpr uint32_t bits_for(uint64_t range) { return range <= 1 ? 0 : 1 + bits_for((range + 1) >> 1); }
+
+        constexpr uint32_t values_per_draw(uint32_t range)
+        {
+            return (range <= 1)                     ? 64
+                   : (range & (range - 1)) == 0     ? (64 / bits_for(range))
+                   : (range > (UINT32_C(1) << 16)) ? 1
+                                                    : 1 + (32 / bits_for(range));
+        }
+
+        //  Takes the next value in [0, range) from the fraction and leaves the remainder in it.
+
+        inline uint32_t take(uint64_t& fraction, uint32_t range)
+        {
+            const __uint128_t product = (__uint128_t)fraction * range;
+
+            fraction = (uint64_t)product;
+
+            return (uint32_t)(product >> 64);
+        }
+    }  // namespace SmallRange
+
+    class SmallRangeDraw
+    {
+       public:
+        explicit SmallRangeDraw(uint32_t range) : range_(range), values_per_draw_(SmallRange::values_per_draw(range))
+        {
+            assert(range > 0);
+        }
+
+        uint32_t range() const { return range_; }
+
+        uint32_t values_per_draw() const { return values_per_draw_; }
+
+        template <typename RNG>
+        uint32_t operator()(RNG& rng)
+        {
+            if (next_value_ == num_values_)
+            {
+                refill(rng);
+            }
+
+            return values_[next_value_++];
+        }
+
+        //  Drops the buffered values, the next call refills from the RNG.
+
+        void reset() { next_value_ = num_values_ = 0; }
+
+       private:
+        static constexpr size_t MAX_VALUES = 4 * SmallRange::values_per_draw(2);
+
+        uint32_t range_;
+        uint32_t values_per_draw_;
+
+        uint32_t next_value_ = 0;
+        uint32_t num_values_ = 0;
+
+        std::array<uint32_t, MAX_VALUES> values_;
+
+        template <typename RNG>
+        void refill(RNG& rng)
+        {
+            const auto draws = rng.next4();
+
+            uint64_t fractions[4] = {draws[0], draws[1], draws[2], draws[3]};
+
+            for (uint32_t i = 0; i < values_per_draw_; i++)
+            {
+                for (size_t lane = 0; lane < 4; lane++)
+                {
+                    values_[(4 * i) + lane] = SmallRange::take(fractions[lane], range_);
+                }
+            }
+
+            next_value_ = 0;
+            num_values_ = 4 * values_per_draw_;
+        }
+    };
+}  // namespace SEFUtility::RNG
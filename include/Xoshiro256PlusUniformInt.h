@@ -0,0 +1,117 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Xoshiro256PlusSmallRange.h"
+
+/*
+    Uniform integers in a compile time range [LOWER, UPPER)
+
+    UniformInt is a reusable draw for a fixed range - dice, bucket counts, table sizes - with the range and its
+    multiplier as compile time constants, the unbiased draws fold the rejection threshold into a constant as well.
+    The path is chosen with 'if constexpr':
+
+        Power of two ranges take log2(range) bits at a time from a 64 bit draw with a shift, so a single draw gives
+            64 / log2(range) values and there is no bias to reject.
+
+        Other small ranges treat the 64 bit draw as a fraction in [0,1) and multiply it by the range repeatedly, the
+            integer part of each product is a value and the fractional part is kept for the next one.  Values are
+            taken while at least 32 bits of the fraction remain, so each value carries no more bias than the
+            multiply and shift reduction of next(lower, upper) - a six sided die gets eleven rolls per draw.
+
+        Ranges above 2^16, and every range which is not a power of two when UNBIASED is set, take one draw per value
+            and give exactly the values of rng.next<LOWER, UPPER>() or rng.next_unbiased<LOWER, UPPER>().
+
+    The buffered paths are the SmallRange carve with the range fixed at compile time, the multiply by a power of two
+    is the shift.  They hold the remains of the last draw, so a UniformInt should be used with a single RNG.  next4()
+    always forwards to the four wide compile time bounded calls of the RNG.
+*/
+
+namespace SEFUtility::RNG
+{
+    template <uint32_t LOWER, uint32_t UPPER, bool UNBIASED = false>
+    class UniformInt
+    {
+       public:
+        static_assert(UPPER > LOWER, "Upper bound must be greater than lower bound");
+
+        static constexpr uint32_t RANGE = UPPER - LOWER;
+        static constexpr bool POWER_OF_TWO = (RANGE & (RANGE - 1)) == 0;
+
+        //  Bits consumed per value - exact for powers of two, rounded up otherwise.
+
+        static constexpr uint32_t BITS_PER_VALUE = SmallRange::bits_for(RANGE);
+
+        static constexpr uint32_t VALUES_PER_DRAW = (RANGE == 1)                 ? 1
+                                                    : UNBIASED && !POWER_OF_TWO ? 1
+                                                                                : SmallRange::values_per_draw(RANGE);
+
+        template <typename RNG>
+        uint64_t operator()(RNG& rng)
+        {
+            if constexpr (RANGE == 1)
+            {
+                return LOWER;
+            }
+            else if constexpr (VALUES_PER_DRAW > 1)
+            {
+                if (remaining_values_ == 0)
+                {
+                    fraction_ = rng.next();
+                    remaining_values_ = VALUES_PER_DRAW;
+                }
+
+                remaining_values_--;
+
+                return (uint64_t)SmallRange::take(fraction_, RANGE) + LOWER;
+            }
+            else if constexpr (UNBIASED)
+            {
+                return rng.template next_unbiased<LOWER, UPPER>();
+            }
+            else
+            {
+                return rng.template next<LOWER, UPPER>();
+            }
+        }
+
+        template <typename RNG>
+        auto next4(RNG& rng) const
+        {
+            if constexpr (UNBIASED)
+            {
+                return rng.template next4_unbiased<LOWER, UPPER>();
+            }
+            else
+            {
+                return rng.template next4<LOWER, UPPER>();
+            }
+        }
+
+       private:
+        uint64_t fraction_ = 0;
+        uint32_t remaining_values_ = 0;
+    };
+}  // namespace SEFUtility::RNG
@@ -0,0 +1,171 @@
+/*
+ Copyright (c) 2021 Stephan Friedl
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+/*
+    Ziggurat tables for the standard normal distribution
+
+    The layout follows Marsaglia and Tsang's Ziggurat with Doornik's symmetric formulation - 256 layers of equal
+    area V, the bottom layer being the rectangle below f(R) plus the tail beyond R.  X[i] is the right edge of layer i,
+    with X[0] = V / f(R) the width of a rectangle of area V standing in for the bottom layer, X[1] = R and X[256] = 0.
+    RATIO[i] = X[i + 1] / X[i] - a signed uniform u with |u| < RATIO[i] lands in the part of layer i which lies
+    entirely under the curve, so u * X[i] is accepted with no further work.
+
+    The tables are generated at compile time.  The standard library math functions are not constexpr, so the few
+    needed here are evaluated with series which are accurate to a few units in the last place - more than enough for
+    the tables, which only have to be consistent between the serial and SIMD implementations.
+*/
+
+namespace SEFUtility::RNG
+{
+    namespace ConstexprMath
+    {
+        constexpr double LN2 = 0.6931471805599453094;
+
+        constexpr double sqrt(double value)
+        {
+            double root = value > 1.0 ? value : 1.0;
+
+            for (size_t i = 0; i < 64; i++)
+            {
+                root = 0.5 * (root + (value / root));
+            }
+
+            return root;
+        }
+
+        constexpr double exp(double value)
+        {
+            //  exp(value) = 2^k * exp(r) with |r| <= ln(2) / 2
+
+            const int64_t k = (int64_t)(value / LN2 + (value < 0 ? -0.5 : 0.5));
+            const double r = value - (k * LN2);
+
+            double term = 1.0;
+            double sum = 1.0;
+
+            for (size_t i = 1; i < 30; i++)
+            {
+                term *= r / i;
+                sum += term;
+            }
+
+            for (int64_t i = 0; i < k; i++)
+            {
+                sum *= 2.0;
+            }
+
+            for (int64_t i = 0; i > k; i--)
+            {
+                sum *= 0.5;
+            }
+
+            return sum;
+        }
+
+        constexpr double log(double value)
+        {
+            //  log(value) = e * ln(2) + 2 * atanh((m - 1) / (m + 1)) with value = m * 2^e and m in [1,2)
+
+            int64_t exponent = 0;
+
+            while (value >= 2.0)
+            {
+                value *= 0.5;
+                exponent++;
+            }
+
+            while (value < 1.0)
+            {
+                value *= 2.0;
+                exponent--;
+            }
+
+            const double s = (value - 1.0) / (value + 1.0);
+
+            double power = s;
+            double sum = 0.0;
+
+            for (size_t i = 1; i < 60; i += 2)
+            {
+                sum += power / i;
+                power *= s * s;
+            }
+
+            return (exponent * LN2) + (2.0 * sum);
+        }
+    }  // namespace ConstexprMath
+
+    //  The generators live in a base so the class is complete when the tables are evaluated.
+
+    struct NormalZigguratGenerators
+    {
+        static constexpr size_t NUM_LAYERS = 256;
+
+        //  Tail start and layer area for 256 layers, from Marsaglia and Tsang
+
+        static constexpr double R = 3.6541528853610088;
+        static constexpr double V = 4.92867323399e-3;
+
+        static constexpr std::array<double, NUM_LAYERS + 1> compute_x()
+        {
+            std::array<double, NUM_LAYERS + 1> x = {};
+
+            double f = ConstexprMath::exp(-0.5 * R * R);
+
+            x[0] = V / f;
+            x[1] = R;
+            x[NUM_LAYERS] = 0.0;
+
+            for (size_t i = 2; i < NUM_LAYERS; i++)
+            {
+                x[i] = ConstexprMath::sqrt(-2.0 * ConstexprMath::log((V / x[i - 1]) + f));
+                f = ConstexprMath::exp(-0.5 * x[i] * x[i]);
+            }
+
+            return x;
+        }
+
+        static constexpr std::array<double, NUM_LAYERS> compute_ratio(const std::array<double, NUM_LAYERS + 1>& x)
+        {
+            std::array<double, NUM_LAYERS> ratio = {};
+
+            for (size_t i = 0; i < NUM_LAYERS; i++)
+            {
+                ratio[i] = x[i + 1] / x[i];
+            }
+
+            return ratio;
+        }
+    };
+
+    struct NormalZiggurat : public NormalZigguratGenerators
+    {
+        static constexpr std::array<double, NUM_LAYERS + 1> X = compute_x();
+        static constexpr std::array<double, NUM_LAYERS> RATIO = compute_ratio(X);
+    };
+}  // namespace SEFUtility::RNG